@@ -263,6 +263,9 @@ int main()
         return EXIT_FAILURE;
     }
 
+    // Show the amount of draw calls in the title bar, press F1 to toggle batching of the draw calls
+    unsigned int drawCallCount = 0;
+
     while (window.isOpen())
     {
         sf::Event event;
@@ -270,6 +273,8 @@ int main()
         {
             if (event.type == sf::Event::Closed)
                 window.close();
+            else if ((event.type == sf::Event::KeyPressed) && (event.key.code == sf::Keyboard::F1))
+                gui.setDrawBatchingEnabled(!gui.isDrawBatchingEnabled());
 
             gui.handleEvent(event);
         }
@@ -277,6 +282,13 @@ int main()
         window.clear();
         gui.draw();
         window.display();
+
+        if (gui.getDrawCallCount() != drawCallCount)
+        {
+            drawCallCount = gui.getDrawCallCount();
+            window.setTitle("TGUI window - " + std::to_string(drawCallCount) + " draw calls"
+                            + (gui.isDrawBatchingEnabled() ? " (batched)" : ""));
+        }
     }
 
     return EXIT_SUCCESS;
@@ -23,9 +23,27 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "GuiBuilder.hpp"
+#include <iostream>
 
-int main()
+int main(int argc, char* argv[])
 {
+    // Convert a form to the compiled format without opening the gui builder: gui-builder --compile form.txt form.bin
+    if ((argc == 4) && (std::string(argv[1]) == "--compile"))
+    {
+        try
+        {
+            tgui::Gui gui;
+            gui.loadWidgetsFromFile(argv[2]);
+            gui.saveWidgetsToBinaryFile(argv[3]);
+            return 0;
+        }
+        catch (const tgui::Exception& e)
+        {
+            std::cerr << "Failed to compile form: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
     GuiBuilder builder;
     builder.mainLoop();
 }
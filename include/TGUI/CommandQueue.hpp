@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_COMMAND_QUEUE_HPP
+#define TGUI_COMMAND_QUEUE_HPP
+
+#include <TGUI/Global.hpp>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of functions that other threads want to have executed on the thread that owns the gui
+    ///
+    /// Widgets are not thread-safe. Instead of locking the whole gui, a worker thread posts a function that changes the
+    /// widget and the gui executes all posted functions at once when updateTime() or draw() is called.
+    ///
+    /// Posting never blocks: the queue is a lock-free list that can be filled by any number of threads, while only the
+    /// thread owning the queue may execute the commands.
+    ///
+    /// Commands that are posted with a key replace the commands with the same key that were posted earlier and weren't
+    /// executed yet. This lets a thread that updates e.g. a progress bar many times per frame only set the last value.
+    /// Values that are posted with postAppend are instead concatenated, so that e.g. all lines that were produced during
+    /// a frame are added to a widget with a single call.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor which discards the commands that were never executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        // The queue is shared between threads and can't be copied
+        CommandQueue(const CommandQueue& copy) = delete;
+        CommandQueue& operator=(const CommandQueue& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to the queue
+        ///
+        /// @param command  Function to execute on the thread that owns the queue
+        /// @param key      When not empty, only the command that was posted last with this key is executed
+        ///
+        /// This function can be called from any thread.
+        ///
+        /// Example:
+        /// @code
+        /// gui.getCommandQueue().post([=]{ chatBox->addLine(line); });
+        /// gui.getCommandQueue().post([=]{ progressBar->setValue(value); }, "progress");
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command, std::string key = "");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a value to the queue that has to be appended to a widget
+        ///
+        /// @param value           Value to append, e.g. a line of text or a row of a table
+        /// @param appendFunction  Function that adds the values to the widget, executed on the thread that owns the queue
+        /// @param key             Values posted with the same key are passed together to a single call of the function
+        ///
+        /// All values with the same key that are executed together are collected in posting order and passed to the function
+        /// of the first of these posts, at the position where that value was posted. Commands that were posted in between
+        /// are thus executed after all values were appended. Appends don't replace commands posted with post() or vice versa,
+        /// even when the same key is used. Values posted without key are passed to their own function call.
+        ///
+        /// This function can be called from any thread.
+        ///
+        /// Example:
+        /// @code
+        /// gui.getCommandQueue().postAppend<sf::String>(line, [=](std::vector<sf::String>& lines){
+        ///     for (const auto& line : lines)
+        ///         chatBox->addLine(line);
+        /// }, "log");
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename T>
+        void postAppend(T value, std::function<void(std::vector<T>&)> appendFunction, std::string key)
+        {
+            auto values = std::make_shared<std::vector<T>>();
+            values->push_back(std::move(value));
+
+            Node* node = new Node{[values,appendFunction]{ appendFunction(*values); }, std::move(key), nullptr, values, {}};
+            node->appendTo = [values](void* otherValues){
+                auto& other = *static_cast<std::vector<T>*>(otherValues);
+                std::move(values->begin(), values->end(), std::back_inserter(other));
+            };
+
+            pushNode(node);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes all commands that were posted so far, in the order in which they were posted
+        ///
+        /// @return Amount of commands that were executed
+        ///
+        /// Commands that are posted while executing the queue are only executed the next time this function is called.
+        /// When a command throws an exception, the remaining commands are still executed before the first exception is
+        /// rethrown. This function must only be called from the thread that owns the queue.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t execute();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are commands waiting to be executed
+        ///
+        /// @return Has nothing been posted since the last time the commands were executed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::function<void()> command;
+            std::string key;
+            Node* next;
+
+            // Only set for appends: the values that are passed to the command and a function to move them to another append
+            std::shared_ptr<void> appendValues;
+            std::function<void(void* otherValues)> appendTo;
+        };
+
+        // Adds a node to the queue, can be called from any thread
+        void pushNode(Node* node);
+
+        // Most recently posted command, each node points to the command that was posted before it
+        std::atomic<Node*> m_newestNode{nullptr};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMMAND_QUEUE_HPP
@@ -137,6 +137,49 @@ namespace tgui
         virtual void add(const Widget::Ptr& widgetPtr, const sf::String& widgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds many widgets to the container at once
+        ///
+        /// @param widgets  Widgets to add, in the order in which they should be added
+        ///
+        /// This has the same result as calling add for each widget without a name, but the storage is only grown once and the
+        /// parents of the container are only asked to redraw the container once instead of for every added widget.
+        /// The widgets are added between beginUpdate and endUpdate, so layout containers only reposition their widgets once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addBulk(const std::vector<Widget::Ptr>& widgets);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones repositioning and redrawing the child widgets until endUpdate is called
+        ///
+        /// Layout containers like VerticalLayout, HorizontalWrap and Grid reposition all their child widgets every time a widget
+        /// is added, inserted or removed. When many widgets are changed between beginUpdate and endUpdate, the child widgets
+        /// are only repositioned once, when endUpdate is called.
+        ///
+        /// Calls can be nested, the postponed work is only done when endUpdate is called as often as beginUpdate was called.
+        /// The positions and sizes of the child widgets are not kept up-to-date until then.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends the update that was started with beginUpdate and does the work that was postponed since then
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether beginUpdate was called without a matching call to endUpdate
+        ///
+        /// @return Is the container postponing the updates of its child widgets?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdating() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a pointer to a widget that was added earlier
         ///
@@ -257,6 +300,8 @@ namespace tgui
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
         ///
+        /// The file can also be a compiled widget file that was created with saveWidgetsToBinaryFile.
+        ///
         /// @throw Exception when file could not be opened or parsing failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void loadWidgetsFromFile(const std::string& filename, bool replaceExisting = true);
@@ -270,6 +315,19 @@ namespace tgui
         void saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a compiled widget file
+        ///
+        /// @param filename  Filename of the compiled widget file
+        ///
+        /// The compiled file contains the same widgets as the text file that saveWidgetsToFile would create, but it can be
+        /// loaded faster with loadWidgetsFromFile as it doesn't have to be tokenized. It can't be edited by hand.
+        ///
+        /// @throw Exception when file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryFile(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
@@ -296,6 +354,16 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets in the compiled format
+        ///
+        /// @param stream  stringstream to which the compiled widget file will be added
+        ///
+        /// @see saveWidgetsToBinaryFile
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryStream(std::stringstream& stream) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets
         ///
@@ -314,6 +382,35 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container keeps a spatial index of its widgets to find the widget below the mouse
+        ///
+        /// @param enabled  Should the index be used?
+        ///
+        /// Without the index, every mouse event loops over all child widgets to find the one below the mouse, and drawing
+        /// the container checks every child widget to skip the ones outside the visible area.
+        /// With the index, only the widgets that overlap with the part of the container below the mouse or with the visible
+        /// area are checked, which is faster for containers that contain many widgets. The index is updated when widgets are
+        /// added, removed, moved, resized or placed in front of or behind other widgets.
+        ///
+        /// The index is disabled by default.
+        ///
+        /// @warning Custom widgets for which mouseOnWidget can return true outside the area given by getWidgetOffset and
+        ///          getFullSize have to override isMouseOnWidgetWithinBounds to return false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container keeps a spatial index of its widgets to find the widget below the mouse
+        ///
+        /// @return Is the index used?
+        ///
+        /// @see setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -346,6 +443,21 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when an area occupied by one of the child widgets of this container has to be redrawn.
+        /// The area is given in absolute coordinates, relative to the gui view.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void childInvalidated(const FloatRect& area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when one of the child widgets of this container may have changed its position or size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childChanged(const Widget& child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -401,6 +513,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rightMouseButtonNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Child widgets aren't clipped by default, so they can be drawn anywhere
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnWithinBounds() const override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -475,6 +593,43 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the spatial index as outdated after widgets were added, removed or reordered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void spatialIndexChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the spatial index or updates the widgets that changed since the index was last used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSpatialIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets from the nodes that were parsed from a widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the nodes that are written to a widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when the child widgets shouldn't be repositioned yet because beginUpdate was called.
+        // The postponedUpdateWidgets function will then be called from endUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool postponeUpdateWidgets();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the child widgets after postponeUpdateWidgets returned true between beginUpdate and endUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void postponedUpdateWidgets();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -491,6 +646,15 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Amount of times beginUpdate was called without a matching endUpdate call, and what endUpdate still has to do
+        unsigned int m_updateNestingLevel = 0;
+        bool m_widgetUpdatePostponed = false;
+        bool m_redrawPostponed = false;
+
+        // Spatial index to speed up mouseOnWhichWidget, only exists when enabled
+        struct SpatialIndex;
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -548,6 +712,36 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Remembers the area that has to be redrawn. There is no parent to pass the area to.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childInvalidated(const FloatRect& area) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something changed that requires the gui to be redrawn
+        ///
+        /// @return Was an area invalidated since the last call to redrawFinished?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRedrawNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the smallest rectangle that contains all areas that were invalidated since the last redraw
+        ///
+        /// @return Area that has to be redrawn, relative to the gui view
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getInvalidatedArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Forgets about the invalidated area after the gui has been redrawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void redrawFinished();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -570,6 +764,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Area that changed since the gui was last drawn
+        bool m_redrawNeeded = true;
+        FloatRect m_invalidatedArea;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
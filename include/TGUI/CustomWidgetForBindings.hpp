@@ -178,6 +178,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The mouseOnWidget implementation isn't known, so the widget has to be checked for every mouse position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseOnWidgetWithinBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,16 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Statistics about the glyphs that were rendered by the font, returned by getGlyphCacheStats
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphCacheStats
+        {
+            std::size_t textureCount = 0;   ///< Amount of glyph textures, the font has one per rendered character size
+            std::size_t textureBytes = 0;   ///< Memory used by the glyph textures, in bytes
+            std::size_t renderedGlyphs = 0; ///< Amount of glyphs that were rendered and uploaded to a glyph texture
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor which will set the font to nullptr
         ///
@@ -212,10 +222,26 @@ namespace tgui
         ///
         /// @return Kerning value for \a first and \a second, in pixels
         ///
+        /// The kerning values are cached per character size, asking for the same pair again doesn't access the font.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal distance between the start of a glyph and the start of the next one
+        ///
+        /// @param codePoint     Unicode code point of the character
+        /// @param characterSize Size of the character
+        /// @param bold          Retrieve the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// This returns the same value as getGlyph(codePoint, characterSize, bold).advance, but the advances are cached per
+        /// character size and style so that measuring and word-wrapping text only has to do a table lookup per character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGlyphAdvance(std::uint32_t codePoint, unsigned int characterSize, bool bold) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the line spacing
         ///
@@ -229,11 +255,76 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture that contains the glyphs of the given character size
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Texture containing the glyphs that getGlyph returned for this character size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Renders the glyphs of all character sizes from glyphs of a single character size
+        ///
+        /// @param characterSize  Character size at which all glyphs are rendered, or 0 to render every character size separately
+        ///
+        /// By default, every character size that is used gets its own glyph texture. When the text size changes often (e.g.
+        /// because of auto-sizing text in a gui that is scaled with the window), many glyph textures are created and uploaded.
+        /// With a reference size, glyphs are only rendered once at that size and are scaled to the requested character size
+        /// when the text is drawn, so the font only has a single glyph texture. The reference size should be at least as large
+        /// as the biggest text, as glyphs that are scaled up look blurry.
+        ///
+        /// This setting is shared by all fonts that use the same SFML font, so it can also be changed via getGlobalFont().
+        /// It should be set before the font is used, because text that was already positioned with the old glyph metrics
+        /// is not updated.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlyphReferenceSize(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size at which the glyphs of all character sizes are rendered
+        ///
+        /// @return Reference character size, or 0 when every character size is rendered separately
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getGlyphReferenceSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much the glyph textures are scaled when drawing text of the given size
+        ///
+        /// @param characterSize  Size of the characters
+        ///
+        /// @return Size of a pixel in the glyph texture compared to a pixel of the text, which is 1 without reference size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getGlyphScale(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the glyph textures of the font
+        ///
+        /// @return Amount of glyph textures, their memory usage and the amount of glyphs that were rendered
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphCacheStats getGlyphCacheStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        struct GlyphMetricsCache;
+
+        // Returns the cache that belongs to the SFML font, so that every Font object that wraps it uses the same cache
+        static std::shared_ptr<GlyphMetricsCache> getGlyphMetricsCache(const std::shared_ptr<sf::Font>& font);
+
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+        std::shared_ptr<GlyphMetricsCache> m_glyphMetricsCache; // Shared by all fonts that wrap the same SFML font
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
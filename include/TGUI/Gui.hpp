@@ -28,7 +28,10 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/CommandQueue.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +180,81 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets are drawn with as few draw calls as possible
+        ///
+        /// @param enabled  Should consecutive triangles that use the same texture be merged into a single draw call?
+        ///
+        /// Batching is disabled by default. When enabled, custom widgets that call target.draw directly must first call
+        /// RenderBatch::flush() or they have to draw via RenderBatch::drawVertices and RenderBatch::drawDrawable.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets are drawn with as few draw calls as possible
+        ///
+        /// @return Is batching of draw calls enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the render target during the last call to draw()
+        ///
+        /// @return Number of draw calls that were needed to draw all widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether anything changed since the last time the gui was drawn
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// When this function returns false, the screen would look identical after calling draw() again. This is only the case
+        /// when no event was handled and no widget was changed since the last frame. Note that animations, tool tips and blinking
+        /// carets depend on time, so call updateTime() each frame when you skip drawing the gui:
+        /// @code
+        /// if (gui.updateTime() || gui.needsRedraw())
+        /// {
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the smallest rectangle that contains all areas that changed since the gui was last drawn
+        ///
+        /// @return Changed area relative to the view of the gui, or an empty rectangle when nothing has to be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getInvalidatedArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the gui is drawn via a cached image of the previous frame
+        ///
+        /// @param enabled  Should the widgets only be drawn again when something changed?
+        ///
+        /// When enabled, the widgets are drawn on an internal render texture which is then drawn on the target. As long as
+        /// needsRedraw() returns false, the render texture of the previous frame is reused without drawing the widgets again.
+        /// Caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawCachingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui is drawn via a cached image of the previous frame
+        ///
+        /// @return Is caching of the drawn widgets enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawCachingEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -239,6 +317,17 @@ namespace tgui
         void add(const Widget::Ptr& widgetPtr, const sf::String& widgetName = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds many widgets to the gui at once
+        ///
+        /// @param widgets  Widgets to add, in the order in which they should be added
+        ///
+        /// This has the same result as calling add for each widget without a name, but the gui is only invalidated once.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addBulk(const std::vector<Widget::Ptr>& widgets);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a pointer to an earlier created widget
         ///
@@ -413,6 +502,15 @@ namespace tgui
         void saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a compiled widget file, which loadWidgetsFromFile can load faster than a text file
+        ///
+        /// @param filename  Filename of the compiled widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryFile(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
@@ -440,6 +538,15 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets in the compiled format
+        ///
+        /// @param stream  stringstream to which the compiled widget file will be added
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryStream(std::stringstream& stream) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -448,6 +555,38 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the internal clock to make animations possible
+        ///
+        /// @return Does the gui have to be drawn again? This is the same value as returned by needsRedraw() afterwards.
+        ///
+        /// This function is called automatically by the draw function, you only need to call it when not calling draw() every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts of which the values were deferred
+        ///
+        /// When Layout::setDeferredUpdatesEnabled(true) was called, changing the position or size of a widget no longer
+        /// immediately updates widgets with layouts that depend on it. All such widgets are updated together when this
+        /// function is called. The draw and updateTime functions call this function automatically.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLayouts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the queue to which other threads can post functions that have to be executed on the gui thread
+        ///
+        /// @return Command queue of the gui
+        ///
+        /// The commands are executed at the start of updateTime(), which is also called by the draw function. They are also
+        /// executed when calling the updateTime overload that takes the elapsed time yourself.
+        /// The returned reference can be used from any thread for as long as the gui exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue& getCommandQueue();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       private:
 
@@ -457,6 +596,12 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widgets on the given target, using the view of the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -484,6 +629,18 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Merges the draw calls of the widgets when batching is enabled
+        RenderBatch m_renderBatch;
+        bool m_drawBatchingEnabled = false;
+        unsigned int m_drawCallCount = 0;
+
+        // Image of the last frame that is reused when nothing changed and caching is enabled
+        std::unique_ptr<sf::RenderTexture> m_cachedFrame;
+        bool m_drawCachingEnabled = false;
+
+        // Functions posted by other threads that still have to be executed
+        CommandQueue m_commandQueue;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
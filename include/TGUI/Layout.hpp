@@ -32,6 +32,8 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +46,9 @@ namespace tgui
     /// @brief Class to store the left, top, width or height of a widget
     ///
     /// You don't have to create an instance of this class, numbers are implicitly cast to this class.
+    ///
+    /// A layout that isn't a constant stores its expression as a flat list of instructions, which is shared between all copies
+    /// of the layout. Parsed expression strings are cached, so creating a layout from a string that was parsed before is cheap.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Layout
     {
@@ -167,7 +172,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isConstant() const
         {
-            return m_operation == Operation::Value;
+            return m_program == nullptr;
         }
 
 
@@ -180,6 +185,44 @@ namespace tgui
         std::string toString() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layouts are only updated once per frame instead of immediately when a widget changes
+        ///
+        /// @param deferred  Should layouts only be recalculated when updateDeferredLayouts is called?
+        ///
+        /// By default, changing the position or size of a widget immediately recalculates all layouts that depend on it, which
+        /// may cause the same widget to be recalculated many times when e.g. the window is resized. When updates are deferred,
+        /// such a change only marks the dependent layouts as dirty. All dirty layouts are then recalculated at once, in an order
+        /// where every widget is only recalculated after the widgets that it depends on, so that each widget is updated only once.
+        ///
+        /// The gui calls updateDeferredLayouts when it is drawn. Until then, widgets that depend on changed widgets still have
+        /// their old position and size.
+        ///
+        /// This setting is global: it applies to the layouts of all widgets, in every gui. Disabling it recalculates all layouts
+        /// that were marked as dirty, and drawing any gui recalculates the dirty layouts of the widgets in all guis. The dirty
+        /// layouts aren't protected by a mutex, so layouts may only be changed from the thread on which the guis are used.
+        /// Widgets can be destroyed while their layouts are dirty, even from signal handlers called by updateDeferredLayouts.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDeferredUpdatesEnabled(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layouts are only updated once per frame instead of immediately when a widget changes
+        ///
+        /// @return Are layouts only recalculated when updateDeferredLayouts is called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isDeferredUpdatesEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all layouts that depend on widgets that changed since the last call to this function
+        ///
+        /// This function only does something when deferred updates are enabled. It is called automatically by Gui::draw.
+        /// It updates the widgets of all guis, not only the ones of the gui that is being drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void updateDeferredLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Provides the layout access to the widget (and its parent) which allows searching potentially referred widgets
@@ -193,58 +236,103 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
+        ///
+        /// @param widget  The widget that is being destroyed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout and inform the connected widget when the value has changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called by the bound widget when its position or size changed
+        ///
+        /// The value is recalculated immediately, unless deferred updates are enabled in which case the layout is marked as dirty.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void boundWidgetChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        struct Program;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Recalculates the value of this layout without informing the connected widget.
+        // Returns whether the value of this layout changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindLayout();
+        bool recalculateDeferredValue();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Calculates the value from the bound widgets and the program, without informing anyone about the change
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        void calculateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses the expression and replaces the contents of this layout with the result
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void parseExpression(std::string expression);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Adds the instructions and bindings of an operand to the end of the program that is being built by this layout
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        void appendOperand(Program& program, const Layout& operand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Find the widget corresponding to the given name and bind it if found
+        // Adds the widget and all widgets of which a layout depends on it to the list, after the widgets that depend on them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        static void addDependentWidgets(Widget* widget, std::unordered_set<Widget*>& visitedWidgets, std::vector<Widget*>& widgetsInReverseOrder);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Disconnects the bindings that were created from a string, the same name may apply to a different widget now
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetStringBindings();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // If widgets are bound, inform them that the layout no longer binds them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindLayout();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tell the bound widgets that this layout requires information about changes to their position or size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetPointers();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // A binding to a widget of which the value is used by the program, or a binding string that still has to be resolved
+        struct Binding
+        {
+            Operation operation = Operation::BindingString;
+            Widget* widget = nullptr;
+            float value = 0;
+        };
+
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
+        std::shared_ptr<const Program> m_program; // Instructions to calculate the value, shared between copies. Null when the layout is a constant.
+        std::vector<Binding> m_bindings; // The bindings used by the program, this part is different for every copy of the layout
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // The widget to which the layout belongs when the callback is set
+
+        static bool m_deferredUpdatesEnabled;
+        static std::unordered_set<Layout*> m_dirtyLayouts; // Layouts of which the bound widget changed while updates were deferred
+        static std::unordered_set<const Widget*> m_widgetsPendingUpdate; // Widgets that updateDeferredLayouts still has to recalculate
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -82,10 +82,28 @@ namespace tgui
         ///
         /// @return Root node of the tree of nodes
         ///
+        /// The stream may contain either the text format or the compiled format created by emitBinary.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the widget file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data could not be parsed, the message contains the line and column of the error
+        ///
+        /// This is faster than parsing from a stream, as the tokens are copied directly from the buffer into the nodes.
+        /// The data may contain either the text format or the compiled format created by emitBinary. Compiled data in which
+        /// nodes are nested more than 256 levels deep is rejected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -94,6 +112,19 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in the compiled binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted
+        /// @param stream   Stream to which the compiled widget file will be added
+        ///
+        /// The parse functions recognize the compiled format and recreate the tree that parsing the text format would produce,
+        /// without having to tokenize the text. Property names are stored in lowercase, list values are already split and
+        /// every distinct string is only stored once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
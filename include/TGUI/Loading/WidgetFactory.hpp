@@ -29,6 +29,7 @@
 
 #include <TGUI/Widget.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Theme.hpp>
 #include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -60,10 +61,43 @@ namespace tgui
         static const std::function<Widget::Ptr()>& getConstructFunction(const std::string& type);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a widget by copying a prototype widget that already has the requested renderer applied
+        ///
+        /// @param type          Type of the widget
+        /// @param rendererData  Renderer that the widget should use, or nullptr to use the renderer from the default theme
+        ///
+        /// The first time a combination of type and renderer is requested, a prototype widget is constructed with the construct
+        /// function and the renderer is set on it. Every call then returns a copy of that prototype, which copies the renderer
+        /// state that the prototype already resolved instead of processing every renderer property again for each new widget.
+        /// The prototype is recreated when the default theme, global font or global text size changed since it was made.
+        ///
+        /// @return Newly created widget, or nullptr when no construct function exists for the type
+        ///
+        /// @warning If the renderers use textures then you MUST call clearPrototypes() before the end of the program
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Widget::Ptr createFromPrototype(const std::string& type, std::shared_ptr<RendererData> rendererData = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all prototypes that were created by createFromPrototype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearPrototypes();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+
+        struct Prototype
+        {
+            Widget::Ptr widget;
+            const Theme* defaultTheme;
+            Font globalFont;
+            unsigned int globalTextSize;
+        };
+
         static std::map<std::string, std::function<Widget::Ptr()>> m_constructFunctions;
+        static std::map<std::pair<std::string, const RendererData*>, Prototype> m_prototypes;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
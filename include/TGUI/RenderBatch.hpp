@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDER_BATCH_HPP
+#define TGUI_RENDER_BATCH_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+#include <memory>
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    #include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the draw calls that the widgets make while the gui is being drawn
+    ///
+    /// When batching is enabled, consecutive triangles that use the same texture and blend mode are merged into a single vertex
+    /// buffer which is only send to the render target when the state changes, when the clipping area changes or when something
+    /// is drawn that can't be batched (e.g. text). The drawing order of the widgets is never changed.
+    ///
+    /// Custom widgets that draw directly on the render target while batching is enabled have to call RenderBatch::flush()
+    /// first, or use the drawVertices and drawDrawable functions instead of calling target.draw themselves.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RenderBatch() = default;
+
+
+        // The batch owns a graphics resource and cannot be copied
+        RenderBatch(const RenderBatch& copy) = delete;
+        RenderBatch& operator=(const RenderBatch& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts collecting the draw calls that are made to a render target
+        ///
+        /// @param target   Render target on which the gui is being drawn
+        /// @param batching Should triangles be merged into larger draw calls? When false, draw calls are only counted.
+        ///
+        /// Every call to begin must be followed by a call to end.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target, bool batching);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the remaining vertices and stops collecting draw calls
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the render target between the last begin and end calls
+        ///
+        /// @return Number of times that something was drawn on the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws primitives, or adds them to the active batch when possible
+        ///
+        /// @param target      Render target to draw to
+        /// @param vertices    Pointer to the vertices
+        /// @param vertexCount Number of vertices in the array
+        /// @param type        Type of primitives to draw
+        /// @param states      Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                                 sf::PrimitiveType type, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws an object that can't be batched, after flushing the vertices that were already collected
+        ///
+        /// @param target   Render target to draw to
+        /// @param drawable Object to draw
+        /// @param states   Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void drawDrawable(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws all vertices that were collected in the active batch
+        ///
+        /// This has to be called before changing the view of the render target or before drawing on it directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the collected vertices to the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget* m_target = nullptr;
+        bool m_batchingEnabled = false;
+        unsigned int m_drawCallCount = 0;
+
+        // Triangles that are waiting to be drawn, they all share the same texture and blend mode
+        std::vector<sf::Vertex> m_vertices;
+        const sf::Texture* m_texture = nullptr;
+        sf::BlendMode m_blendMode;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        std::unique_ptr<sf::VertexBuffer> m_vertexBuffer;
+    #endif
+
+        // Batch that was active when begin was called, so that it can be restored when end is called
+        RenderBatch* m_previousBatch = nullptr;
+
+        static RenderBatch* m_activeBatch;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BATCH_HPP
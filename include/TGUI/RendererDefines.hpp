@@ -34,15 +34,17 @@
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
     void CLASS::set##NAME(const Outline& outline) \
     { \
-        setProperty(toLower(#NAME), {outline}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,15 +52,17 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(Color color) \
     { \
-        setProperty(toLower(#NAME), {color}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,15 +70,17 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(TextStyle style) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{style}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +88,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -93,7 +100,8 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{number}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,9 +109,10 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -112,7 +121,8 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(toLower(#NAME), ObjectConverter{flag}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,18 +131,16 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTexture(); \
-        else \
-        { \
-            m_data->propertyValuePairs[toLower(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[toLower(#NAME)].getTexture(); \
-        } \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter& value = m_data->getOrAddProperty(id); \
+        if (value.getType() == ObjectConverter::Type::None) \
+            value = {Texture{}}; \
+        return value.getTexture(); \
     } \
     void CLASS::set##NAME(const Texture& texture) \
     { \
-        setProperty(toLower(#NAME), {texture}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,19 +148,21 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(toLower(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        ObjectConverter* value = m_data->findProperty(id); \
+        if (value) \
+            return value->getRenderer(); \
         else \
         { \
             const auto& renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[toLower(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            m_data->getOrAddProperty(id) = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<RendererData> renderer) \
     { \
-        setProperty(toLower(#NAME), {renderer}); \
+        static const RendererPropertyId id = getRendererPropertyId(toLower(#NAME)); \
+        setProperty(id, {renderer}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,18 +30,52 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Compact number that identifies a renderer property
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using RendererPropertyId = std::size_t;
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a renderer property
+    ///
+    /// @param property  Name of the property in lowercase
+    ///
+    /// @return Id of the property, the first time a name is passed to this function a new id is assigned to it
+    ///
+    /// Looking up the id requires hashing the name, so the result should be stored when a property is accessed often.
+    /// This function can be called from any thread.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API RendererPropertyId getRendererPropertyId(const std::string& property);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the name of a renderer property
+    ///
+    /// @param id  Id of the property that was returned by getRendererPropertyId
+    ///
+    /// @return Lowercase name of the property
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API const std::string& getRendererPropertyName(RendererPropertyId id);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    struct RendererData
+    struct TGUI_API RendererData
     {
         RendererData() = default;
 
+        // The slots can't be copied, as they point into the property-value pairs of the other object
+        RendererData(const RendererData& other);
+        RendererData& operator=(const RendererData& other);
+
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
             auto data = std::make_shared<RendererData>();
@@ -68,9 +102,48 @@ namespace tgui
             return rendererData;
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property
+        ///
+        /// @param id  Id of the property, as returned by getRendererPropertyId
+        ///
+        /// @return Pointer to the value of the property, or a nullptr when the property hasn't been set
+        ///
+        /// Unlike a search in propertyValuePairs, this is only an index in an array as long as no properties are added or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter* findProperty(RendererPropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, adding it to the property-value pairs if it didn't exist yet
+        ///
+        /// @param id  Id of the property, as returned by getRendererPropertyId
+        ///
+        /// @return Reference to the value of the property, which is an empty object if the property was added by this function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& getOrAddProperty(RendererPropertyId id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the renderer data that properties were removed from propertyValuePairs
+        ///
+        /// The ids that are passed to findProperty are mapped to pointers into propertyValuePairs. Properties that are added
+        /// directly to propertyValuePairs are noticed automatically, but after erasing elements or assigning a new map to it,
+        /// this function has to be called before the renderer is used again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidatePropertySlots();
+
+
         std::map<std::string, ObjectConverter> propertyValuePairs;
         std::map<const void*, std::function<void(const std::string& property)>> observers;
         bool shared = true;
+
+    private:
+
+        // Pointers into propertyValuePairs, indexed by property id. They are rebuilt when the amount of properties changed.
+        std::vector<ObjectConverter*> m_slots;
+        std::size_t m_slotsPropertyCount = 0;
+        bool m_slotsValid = false;
     };
 
 
@@ -197,6 +270,17 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param id     Id of the property that you would like to change, as returned by getRendererPropertyId
+        /// @param value  New value of the property
+        ///
+        /// This function is faster than the version that takes a string, as it doesn't require the name to be converted and searched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(RendererPropertyId id, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -33,6 +33,7 @@
 #include <TGUI/Animation.hpp>
 #include <SFML/System/String.hpp>
 #include <type_traits>
+#include <cassert>
 #include <functional>
 #include <typeindex>
 #include <memory>
@@ -236,8 +237,11 @@ namespace tgui
         /// @param extraParameters  Amount of extra parameters to reserve space for
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Signal(std::string&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+            m_name          {std::move(name)},
+            m_parameterCount{1 + extraParameters}
         {
+            assert(m_parameterCount <= maxParameters);
+
             if (1 + extraParameters > internal_signal::parameters.size())
                 internal_signal::parameters.resize(1 + extraParameters);
         }
@@ -312,15 +316,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty() || !m_enabled)
+            if (!hasHandlers() || !m_enabled)
                 return false;
 
             internal_signal::parameters[0] = static_cast<const void*>(&widget);
 
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
+            // Keep the handlers alive in case the widget (and this signal) gets destroyed during the handler.
+            // Connecting or disconnecting handlers while emitting creates a new list, so the list can be iterated without copying it.
+            const std::shared_ptr<const HandlerList> handlers = m_handlers;
+
+            // A handler may emit another signal, which would overwrite the parameters for the remaining handlers
+            const std::size_t parameterCount = m_parameterCount;
+            const void* parameters[maxParameters];
+            for (std::size_t i = 0; i < parameterCount; ++i)
+                parameters[i] = internal_signal::parameters[i];
+
+            for (auto it = handlers->begin(); it != handlers->end(); ++it)
+            {
+                if (it != handlers->begin())
+                {
+                    for (std::size_t i = 0; i < parameterCount; ++i)
+                        internal_signal::parameters[i] = parameters[i];
+                }
+
+                it->function();
+            }
 
             return true;
         }
@@ -383,12 +403,57 @@ namespace tgui
         static std::shared_ptr<Widget> getWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether there is at least one handler connected to the signal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && !m_handlers->empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores a handler that will be called when the signal is emitted
+        ///
+        /// @param handler  Function to call, which reads its parameters from internal_signal::parameters
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()> handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id;
+            std::function<void()> function;
+        };
+
+        using HandlerList = std::vector<Handler>;
+
+        // Maximum amount of parameters (including the widget) that a signal can pass to its handlers
+        static constexpr std::size_t maxParameters = 4;
+
         bool m_enabled = true;
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::size_t m_parameterCount = 1;
+
+        // The list is shared with the emit function while handlers are being called, it is copied when it has to change during that time
+        std::shared_ptr<HandlerList> m_handlers;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the list of handlers so that it can be changed without affecting a signal that is being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        HandlerList& getHandlersForModification();
     };
 
     #define TGUI_SIGNAL_VALUE_DECLARATION(TypeName, Type) \
@@ -434,7 +499,7 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
+            if (!hasHandlers()) \
                 return false; \
          \
             internal_signal::parameters[1] = static_cast<const void*>(&param); \
@@ -672,7 +737,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id, int index)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             internal_signal::parameters[1] = static_cast<const void*>(&item);
@@ -722,7 +787,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             internal_signal::parameters[1] = static_cast<const void*>(&type);
@@ -814,7 +879,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
+            if (!hasHandlers())
                 return false;
 
             internal_signal::parameters[1] = static_cast<const void*>(&item);
@@ -32,6 +32,8 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -306,6 +308,9 @@ namespace tgui
         /// \param target Render target to draw to
         /// \param states Current render states
         ///
+        /// The glyphs are drawn as triangles that use the texture of the font. When draw batching is enabled in the gui,
+        /// consecutive texts that use the same font and character size are thus drawn together in a single draw call.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
@@ -347,15 +352,26 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the quads of the glyphs again if something changed since they were last created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        sf::Text     m_text; // Only stores the properties, the text is drawn with the vertices below
         Vector2f     m_size;
         Font         m_font;
         Color        m_color;
         Color        m_outlineColor;
         float        m_opacity = 1;
+
+        // Triangles of the glyphs in the font texture, the outline is drawn behind the text
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable std::vector<sf::Vertex> m_outlineVertices;
+        mutable bool m_verticesNeedUpdate = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,14 +45,29 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Stores which pixels of an image are completely transparent, using a single bit per pixel
+    struct TGUI_API ImageAlphaMask
+    {
+        sf::Vector2u size;
+        std::vector<bool> transparentPixels;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     // Used by the Texture class
     struct TGUI_API TextureData
     {
         std::shared_ptr<sf::Image> image;
+        std::shared_ptr<ImageAlphaMask> alphaMask; // Only used when the image isn't kept in memory
         std::unique_ptr<SvgImage> svgImage;
         sf::Texture texture;
         sf::IntRect rect;
 
+        // When the texture manager placed the image in a texture atlas, the texture member is left empty
+        // and the image is instead located at atlasRect inside atlasTexture
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::IntRect atlasRect;
+
 #ifndef TGUI_NEXT
         sf::Shader* shader = nullptr;
 #endif
@@ -29,7 +29,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <unordered_map>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -44,6 +46,17 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief What is kept in memory on the CPU side after an image file has been uploaded to the graphics card
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class ImageRetention
+        {
+            Image,     ///< Keep the entire image (default)
+            AlphaMask, ///< Only remember which pixels are transparent, using one bit per pixel
+            None       ///< Keep nothing, Texture::isTransparentPixel will always return false
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -79,10 +92,141 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Memory that is used by the textures that were loaded from a single file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct MemoryUsage
+        {
+            std::size_t imageBytes = 0;   ///< Bytes of the pixels that are kept in memory on the CPU side (sf::Image)
+            std::size_t textureBytes = 0; ///< Bytes of the pixels that were uploaded to the graphics card (sf::Texture)
+            std::size_t alphaMaskBytes = 0; ///< Bytes used to remember which pixels are transparent when the image isn't kept
+            unsigned int textures = 0;    ///< Amount of different parts of the file that are loaded in a texture
+            unsigned int users = 0;       ///< Amount of Texture objects that are using one of the textures
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory is being used by the loaded textures, grouped by the file they were loaded from
+        ///
+        /// @return Memory usage for every file from which at least one texture is loaded
+        ///
+        /// The amount of bytes are estimates based on the size of the images and textures, with 4 bytes per pixel.
+        /// An image is only counted once, even when multiple textures are created from different parts of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::map<sf::String, MemoryUsage> getMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images that are loaded from files are packed together in shared textures
+        ///
+        /// @param enabled  Should images be placed in a texture atlas?
+        ///
+        /// When enabled, images and parts of images that are loaded afterwards are placed in atlas textures of 1024x1024
+        /// pixels, so that widgets using different images (or different parts of a theme image) can be drawn with the
+        /// same texture. Images that are wider or higher than 256 pixels and svg images still get their own texture.
+        /// The atlas textures are never smooth, a texture gets its own copy of the image when Texture::setSmooth is called.
+        ///
+        /// The texture atlas is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images that are loaded from files are packed together in shared textures
+        ///
+        /// @return Are images placed in a texture atlas?
+        ///
+        /// @see setAtlasEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes what is kept in memory on the CPU side after an image has been loaded
+        ///
+        /// @param retention  Whether to keep the image, only an alpha mask or nothing
+        ///
+        /// By default every image is kept in memory next to the texture, even though the pixels are only needed to check
+        /// whether the mouse is on a transparent pixel (when the TransparentTexture renderer property is set).
+        /// With ImageRetention::AlphaMask only a single bit is kept per pixel, which is enough for these checks.
+        /// With ImageRetention::None, widgets with a transparent texture will react on the entire area of the image.
+        ///
+        /// When the image isn't kept, all parts of the same image file share a single texture that contains the entire image.
+        /// If the texture atlas is enabled then the file will however be loaded again when another part of it is needed.
+        ///
+        /// This setting only affects images that are loaded afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setImageRetention(ImageRetention retention);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns what is kept in memory on the CPU side after an image has been loaded
+        ///
+        /// @return Whether the image, only an alpha mask or nothing is kept
+        ///
+        /// @see setImageRetention
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ImageRetention getImageRetention();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Creates a copy of texture data that was placed in the texture atlas, with the image in its own texture
+        ///
+        /// @param data  Texture data that is stored in the texture atlas
+        ///
+        /// @return New texture data that isn't managed by the texture manager, or nullptr when the texture couldn't be created
+        ///
+        /// The original texture data is left untouched, as it may still be used by other textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<TextureData> copyOutOfAtlas(const TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        using ImageMap = std::map<sf::String, std::list<TextureDataHolder>>;
+
+        // Location of a texture inside the image map, for quick access when a texture is copied or destroyed
+        struct TextureDataLocation
+        {
+            ImageMap::iterator imageIt;
+            std::list<TextureDataHolder>::iterator dataIt;
+        };
+
+        // Row of images inside an atlas texture, all images are placed next to each other at the top of the row
+        struct AtlasShelf
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int width;
+        };
+
+        // Texture in which multiple images are stored
+        struct AtlasPage
+        {
+            std::shared_ptr<sf::Texture> texture;
+            std::vector<AtlasShelf> shelves;
+            unsigned int images = 0;
+
+            // Finds a place for an image of the given size using a shelf packing algorithm
+            bool findSpace(sf::Vector2u size, unsigned int pageSize, sf::Vector2u& pos);
+        };
+
+        // Places part of the image in the atlas, returns false if it has to be stored in its own texture
+        static bool addToAtlas(TextureData& data, const sf::IntRect& partRect);
+
+        // Releases the place in the atlas that was used by the image. The space is reused once the whole page is empty.
+        static void releaseAtlasSpace(TextureData& data);
+
+        static ImageMap m_imageMap;
+        static std::unordered_map<const TextureData*, TextureDataLocation> m_textureDataLocations;
+        static std::list<AtlasPage> m_atlasPages;
+        static bool m_atlasEnabled;
+
+        // Textures that contain an entire image file of which the pixels were not kept in memory
+        static std::map<sf::String, std::shared_ptr<sf::Texture>> m_fileTextures;
+        static ImageRetention m_imageRetention;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -422,6 +422,15 @@ namespace tgui
         virtual void moveToBack();
 #endif
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the area occupied by the widget has to be redrawn
+        ///
+        /// Widgets call this function themselves when they change. You only need to call it when the widget changed in a way
+        /// that it can't detect itself, e.g. after drawing on a Canvas or in a custom widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores some data into the widget
         /// @param userData  Data to store
@@ -596,6 +605,28 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the widget draws nothing outside the area given by getWidgetOffset and getFullSize.
+        /// The parent container skips drawing such a widget when that area lies outside the visible part of the container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isDrawnWithinBounds() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether mouseOnWidget can only return true inside the area given by getWidgetOffset and getFullSize.
+        /// The spatial index of the parent container only checks such a widget when the mouse is near that area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isMouseOnWidgetWithinBounds() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether invalidate() was called while the widget had no parent since the last call to this function.
+        /// Widgets that draw subwidgets without adding them to a container (e.g. their scrollbars) use this to find out
+        /// whether they have to invalidate themselves after passing an event to such a subwidget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wasInvalidatedWithoutParent();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -887,6 +918,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // Was invalidate() called while the widget had no parent to forward it to?
+        bool m_invalidatedWithoutParent = false;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -936,6 +970,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Layout; // Layout accesses the position and size layouts and the layouts bound to them to update deferred layouts
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
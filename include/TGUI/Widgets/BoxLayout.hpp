@@ -152,6 +152,12 @@ namespace tgui
         virtual void updateWidgets() = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Repositions the widgets after the update was postponed by beginUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postponedUpdateWidgets() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -53,6 +53,7 @@ namespace tgui
         {
             Text text;
             sf::String string;
+            double top = 0; // Vertical offset of the line, relative to the first line after it was last recalculated
         };
 
 
@@ -389,7 +390,12 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Recalculates the vertical offsets of the lines, starting from the given line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateLineOffsets(std::size_t firstLine);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the space used by all the lines. The line offsets must already be up-to-date.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
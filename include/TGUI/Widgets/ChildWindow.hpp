@@ -367,6 +367,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The child widgets are clipped to the child window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnWithinBounds() const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The area in which the mouse is on the child window grows when the window is resizable
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseOnWidgetWithinBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,6 +499,41 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether items are looked up by their text or id with a hash table
+        ///
+        /// @param enabled  Should a hash table from item text and id to the item be kept?
+        ///
+        /// @see ListBox::setItemIndexingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIndexingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether items are looked up by their text or id with a hash table
+        /// @return Is a hash table from item text and id to the item kept?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIndexingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text in the list
+        ///
+        /// @param filter  Text that the items in the list must contain, or an empty string to show all items
+        ///
+        /// The filter only affects the list that opens, items can still be selected with the other functions.
+        /// @see ListBox::setItemFilter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemFilter(const sf::String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the items in the list must contain
+        /// @return Filter that was set with setItemFilter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItemFilter() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
@@ -30,6 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
+#include <functional>
 #include <regex>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +374,9 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The predefined validators from the Validator struct don't use std::regex: they are checked by hand-written code that
+        /// also supports unicode text and that only has to look at the typed character when the user enters text.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -391,6 +395,23 @@ namespace tgui
         const std::string& getInputValidator() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Defines how the text input should look like with a function instead of a regex
+        ///
+        /// @param validator  Function that returns whether the given text is allowed in the edit box
+        ///
+        /// The function is called with the text that the edit box would contain after the change. Text passed to setText is
+        /// cleared and typed characters are rejected when the function returns false, just like with a regex validator.
+        /// Passing an empty function accepts any input. While a function is set, getInputValidator returns an empty string.
+        ///
+        /// Example:
+        /// @code
+        /// editBox->setInputValidatorFunction([](const sf::String& text){ return text.getSize() <= 3; });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setInputValidatorFunction(const std::function<bool(const sf::String& text)>& validator);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a suffix at the right side of the edit box
         ///
@@ -525,6 +546,18 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the text is accepted by the input validator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTextValid(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the validator accepts the text after the selected characters get replaced by the typed character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCharacterValid(std::uint32_t key) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the position of the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,8 +614,21 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
+        // The predefined validators are recognized so that they don't have to be checked with std::regex
+        enum class ValidatorType
+        {
+            All,
+            Int,
+            UInt,
+            Float,
+            Regex,
+            Function
+        };
+
         std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        std::regex    m_regex; // Only compiled for validators that aren't predefined
+        ValidatorType m_validatorType = ValidatorType::All;
+        std::function<bool(const sf::String&)> m_validatorFunction;
 
         // The text alignment
         Alignment     m_textAlignment = Alignment::Left;
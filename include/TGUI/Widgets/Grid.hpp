@@ -357,6 +357,12 @@ namespace tgui
         void updateWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the widgets after the update was postponed by beginUpdate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void postponedUpdateWidgets() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,12 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The child widgets are clipped to the group
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnWithinBounds() const override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -457,6 +458,57 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether items are looked up by their text or id with a hash table
+        ///
+        /// @param enabled  Should a hash table from item text and id to the item be kept?
+        ///
+        /// When enabled, functions that search an item by its text or id (e.g. contains, containsId, setSelectedItem,
+        /// setSelectedItemById, removeItemById, changeItemById and getItemById) no longer compare the value with every item.
+        /// This is useful when the list box contains many items, at the cost of some extra memory.
+        /// The table is rebuilt on the next lookup after items were removed or changed.
+        ///
+        /// Indexing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIndexingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether items are looked up by their text or id with a hash table
+        ///
+        /// @return Is a hash table from item text and id to the item kept?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIndexingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param filter  Text that the shown items must contain, or an empty string to show all items
+        ///
+        /// The comparison ignores the case of ASCII letters. When the new filter contains the previous one (e.g. because the
+        /// user typed an extra character), only the items that were still shown have to be checked again.
+        /// Hidden items keep their index and can still be accessed and selected with the other functions.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemFilter(const sf::String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that the shown items must contain
+        ///
+        /// @return Filter that was set with setItemFilter, or an empty string when all items are shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getItemFilter() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are shown in the list box
+        ///
+        /// @return Number of items that pass the filter, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFilteredItemCount() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -588,6 +640,32 @@ namespace tgui
         void updateSelectedItem(int item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given text or id, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndex(const sf::String& item) const;
+        int findItemIndexById(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the hash tables again if items were removed or changed since the last lookup
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the item contains the filter text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool itemPassesFilter(const sf::String& item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts between the index of an item and the row in which it is shown. Hidden items have row -1.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getItemRow(int index) const;
+        int getItemAtRow(std::size_t row) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,6 +718,16 @@ namespace tgui
 
         bool m_autoScroll = true;
 
+        // Optional hash tables from the text and id of an item to the index of the first item that has it
+        bool m_itemIndexingEnabled = false;
+        mutable bool m_itemIndexOutdated = false;
+        mutable std::unordered_map<std::u32string, std::size_t> m_itemIndexByText;
+        mutable std::unordered_map<std::u32string, std::size_t> m_itemIndexById;
+
+        // Indices of the items that contain the filter text, in ascending order. Only used when the filter isn't empty.
+        sf::String m_itemFilter;
+        std::vector<std::size_t> m_filteredItems;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
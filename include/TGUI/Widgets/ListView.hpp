@@ -448,6 +448,53 @@ namespace tgui
         std::vector<std::vector<sf::String>> getItemRows() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view ask for the contents of the items instead of storing all items itself
+        ///
+        /// @param itemCount   Amount of items in the list
+        /// @param cellGetter  Function that returns the text of a cell, given the row index and column index
+        ///
+        /// In virtual mode the list view only creates texts for the items that are visible and a few items around them,
+        /// so memory usage doesn't grow with the amount of items. The cell getter is called when an item becomes visible.
+        ///
+        /// Any items that were added before are removed. The addItem, changeItem, removeItem, setItemIcon and sort functions
+        /// have no effect in virtual mode. Call removeAllItems to leave virtual mode.
+        ///
+        /// @see setVirtualItemCount
+        /// @see reloadVirtualItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, std::function<sf::String(std::size_t row, std::size_t column)> cellGetter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items when the list view is in virtual mode
+        ///
+        /// @param itemCount  Amount of items in the list
+        ///
+        /// Selected items that no longer exist are deselected. When auto-scroll is enabled and items were added then the
+        /// list view scrolls to the bottom, just like when calling addItem.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Asks for the contents of the visible items again when the list view is in virtual mode
+        ///
+        /// This function has to be called when the data that the cell getter returns has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reloadVirtualItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list view is in virtual mode
+        ///
+        /// @return Was setVirtualItems called?
+        ///
+        /// @see setVirtualItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isVirtual() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sort items
         ///
@@ -877,6 +924,18 @@ namespace tgui
         void updateHorizontalScrollbarMaximum();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texts for the items around the visible area when in virtual mode. Items that were already loaded are
+        // kept unless reloadAll is true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItems(bool reloadAll = false);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item with the given index, or a nullptr when the item isn't loaded in virtual mode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Item* getLoadedItem(std::size_t index) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the header text for a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -917,9 +976,13 @@ namespace tgui
     protected:
 
         std::vector<Column> m_columns;
-        std::vector<Item>   m_items;
+        std::vector<Item>   m_items; // In virtual mode, only contains the items starting from m_virtualItemsStart that are loaded
         std::set<std::size_t> m_selectedItems;
 
+        std::function<sf::String(std::size_t, std::size_t)> m_virtualCellGetter; // Only set in virtual mode
+        std::size_t m_virtualItemCount = 0;
+        std::size_t m_virtualItemsStart = 0;
+
         int m_hoveredItem = -1;
         int m_lastMouseDownItem = -1;
 
@@ -472,6 +472,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // An open menu is drawn below (or above) the menu bar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnWithinBounds() const override;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // The mouse can also be on top of an open menu
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseOnWidgetWithinBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -81,6 +81,13 @@ namespace tgui
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Unlike other groups, the child widgets aren't clipped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawnWithinBounds() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -509,21 +509,39 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers which part of the text is about to be changed, so that only the paragraphs around it have to be split into
+        // lines again. Must be called before the characters are removed from or inserted into m_text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markTextChanged(std::size_t pos, std::size_t removedLength);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text box (by using word wrap).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text into lines. Only the paragraphs that changed since the last call are word-wrapped again.
+        // Pass 0 as maximum width to only split the text on newlines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines(float maxLineWidth);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the caret position and the text pieces after the text or the selection changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the five text pieces with the lines near the visible area. Other lines aren't given to the text objects.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSelectionTextStrings();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -622,6 +640,26 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // Information about the paragraphs (text between newlines) that were split into m_lines
+        struct Paragraph
+        {
+            std::size_t length;    // Amount of characters, without the newline at the end
+            std::size_t lineCount; // Amount of lines after word-wrapping
+            float width;           // Width of the line when the text isn't word-wrapped
+        };
+
+        // The settings that m_lines was created with and the part of the text that changed since then,
+        // which allows updating only the changed paragraphs
+        std::vector<Paragraph> m_paragraphs;
+        std::size_t m_wrappedTextLength = 0;
+        std::size_t m_unchangedTextStart = 0; // Amount of characters at the front that weren't changed
+        std::size_t m_unchangedTextEnd = 0;   // Amount of characters at the back that weren't changed
+        bool m_textChanged = false;
+        float m_wrappedTextMaxWidth = 0;
+        const sf::Font* m_wrappedTextFont = nullptr;
+        unsigned int m_wrappedTextSize = 0;
+        bool m_wrappedTextWidthsCalculated = false;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -629,6 +667,10 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // Range of lines that are stored in the text objects
+        std::size_t m_firstTextLine = 0;
+        std::size_t m_lastTextLine = 0;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
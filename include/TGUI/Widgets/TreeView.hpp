@@ -30,6 +30,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,8 +61,11 @@ namespace tgui
             Text text;
             unsigned depth = 0;
             bool expanded = true;
+            bool lazyChildren = false; ///< Children are added by the lazy item loader when the node is expanded the first time
+            std::size_t rowCount = 1;  ///< Amount of rows taken by this node and its visible children
             Node* parent;
             std::vector<std::shared_ptr<Node>> nodes;
+            std::unique_ptr<std::unordered_map<std::u32string, Node*>> childIndex; ///< Lookup of children by text, only used with many children
         };
 
 
@@ -141,6 +146,31 @@ namespace tgui
         bool addItem(const std::vector<sf::String>& hierarchy, bool createParents = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new collapsed item to the tree view of which the children will only be added when it gets expanded
+        ///
+        /// @param hierarchy     Hierarchy of items, with the last item being the lazy item
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the item was added (always the case if createParents is true)
+        ///
+        /// The item is shown as a branch. When it is expanded for the first time, the function that was passed to
+        /// setLazyItemLoader is called with the hierarchy of the item, which can then add the children with addItem.
+        /// The expandAll function does not expand lazy items that were never expanded before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addLazyItem(const std::vector<sf::String>& hierarchy, bool createParents = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the function that adds the children of a lazy item when it is expanded for the first time
+        ///
+        /// @param loader  Function that is called with the hierarchy of the item that is being expanded
+        ///
+        /// @see addLazyItem
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLazyItemLoader(const std::function<void(const std::vector<sf::String>& hierarchy)>& loader);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands the given item
         ///
@@ -406,7 +436,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void createNode(std::vector<std::shared_ptr<Node>>& menus, Node* parent, const sf::String& text);
+        Node* createNode(std::vector<std::shared_ptr<Node>>& menus, Node* parent, const sf::String& text);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -415,6 +445,54 @@ namespace tgui
         Node* findParentNode(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an item, creating the parents when requested
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Node* addItemImpl(const std::vector<sf::String>& hierarchy, bool createParents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a node and its children from the tree
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeNode(Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Expands or collapses a node, only updating the rows of the visible items that are affected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setNodeExpanded(Node* node, bool expand);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row of a visible node, the row count of the nodes must be up-to-date
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getNodeRow(const Node* node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts nodes in the list of visible items at the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertVisibleNodes(std::size_t row, const std::vector<std::shared_ptr<Node>>& nodes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a range of rows from the list of visible items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseVisibleNodes(std::size_t row, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places the text of a node next to its icon
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextPosition(Node& node, float textPadding);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbars after the amount of visible items or their width changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbars();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Expands or collapses one of the visible items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,7 +514,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rebuilds the list of visible items and positions the texts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
+        void updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +551,11 @@ namespace tgui
         std::vector<std::shared_ptr<Node>> m_nodes;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
 
+        // Lookup of the root nodes by text, only created when there are many root nodes
+        std::unique_ptr<std::unordered_map<std::u32string, Node*>> m_rootIndex;
+
+        std::function<void(const std::vector<sf::String>& hierarchy)> m_lazyItemLoader;
+
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
 
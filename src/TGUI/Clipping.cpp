@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -75,6 +76,9 @@ namespace tgui
         if (size.y > m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y)
             size.y = m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y;
 
+        // Everything that was queued before the clipping area changes has to be drawn with the old view
+        RenderBatch::flush();
+
         if ((size.x >= 0) && (size.y >= 0))
         {
             sf::View view{{std::round(viewTopLeft.x),
@@ -97,6 +101,7 @@ namespace tgui
 
     Clipping::~Clipping()
     {
+        RenderBatch::flush();
         m_target.setView(m_oldView);
     }
 
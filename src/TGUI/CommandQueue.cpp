@@ -0,0 +1,140 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/CommandQueue.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <exception>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    CommandQueue::~CommandQueue()
+    {
+        Node* node = m_newestNode.load();
+        while (node)
+        {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(std::function<void()> command, std::string key)
+    {
+        pushNode(new Node{std::move(command), std::move(key), nullptr, nullptr, {}});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::pushNode(Node* node)
+    {
+        node->next = m_newestNode.load(std::memory_order_relaxed);
+        while (!m_newestNode.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::execute()
+    {
+        // Take all commands at once, other threads can immediately start filling the queue again
+        Node* node = m_newestNode.exchange(nullptr, std::memory_order_acquire);
+        if (!node)
+            return 0;
+
+        // The list starts with the newest command, so the first command that we find for a key is the one to keep
+        std::vector<std::unique_ptr<Node>> commands;
+        std::unordered_set<std::string> keys;
+        while (node)
+        {
+            std::unique_ptr<Node> command{node};
+            node = node->next;
+
+            if (command->appendTo || command->key.empty() || keys.insert(command->key).second)
+                commands.push_back(std::move(command));
+        }
+
+        std::reverse(commands.begin(), commands.end());
+
+        // Appends with the same key are moved into the oldest one, which will pass all values to the widget at once
+        std::unordered_map<std::string, Node*> appendTargets;
+        for (auto& command : commands)
+        {
+            if (!command->appendTo || command->key.empty())
+                continue;
+
+            const auto it = appendTargets.find(command->key);
+            if (it != appendTargets.end())
+            {
+                command->appendTo(it->second->appendValues.get());
+                command = nullptr;
+            }
+            else
+                appendTargets[command->key] = command.get();
+        }
+
+        // An exception doesn't stop the other commands from being executed, the first one is passed on afterwards
+        std::size_t executedCount = 0;
+        std::exception_ptr exception;
+        for (const auto& command : commands)
+        {
+            if (!command)
+                continue;
+
+            try
+            {
+                command->command();
+            }
+            catch (...)
+            {
+                if (!exception)
+                    exception = std::current_exception();
+            }
+
+            ++executedCount;
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+
+        return executedCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CommandQueue::isEmpty() const
+    {
+        return m_newestNode.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
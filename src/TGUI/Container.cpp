@@ -28,13 +28,240 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <algorithm>
+#include <unordered_map>
 #include <cassert>
+#include <iterator>
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the part of the render target that is visible through its current view, in the coordinates of the transform
+        FloatRect getVisibleArea(const sf::RenderTarget& target, const sf::Transform& transform)
+        {
+            const sf::Transform toLocal = transform.getInverse() * target.getView().getInverseTransform();
+            const sf::Vector2f corners[] = {toLocal.transformPoint(-1, -1), toLocal.transformPoint(1, -1),
+                                            toLocal.transformPoint(-1, 1), toLocal.transformPoint(1, 1)};
+
+            sf::Vector2f topLeft = corners[0];
+            sf::Vector2f bottomRight = corners[0];
+            for (const auto& corner : corners)
+            {
+                topLeft.x = std::min(topLeft.x, corner.x);
+                topLeft.y = std::min(topLeft.y, corner.y);
+                bottomRight.x = std::max(bottomRight.x, corner.x);
+                bottomRight.y = std::max(bottomRight.y, corner.y);
+            }
+
+            return {topLeft.x, topLeft.y, bottomRight.x - topLeft.x, bottomRight.y - topLeft.y};
+        }
+
+        // Returns the area of the widget relative to its parent, with a positive width and height
+        FloatRect getWidgetBounds(const Widget& widget)
+        {
+            const Vector2f pos = widget.getPosition() + widget.getWidgetOffset();
+            const Vector2f size = widget.getFullSize();
+            return {std::min(pos.x, pos.x + size.x), std::min(pos.y, pos.y + size.y), std::abs(size.x), std::abs(size.y)};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The area covered by the widgets is divided in a grid of cells that each store the indices (in m_widgets) of the widgets
+    // that overlap with the cell. Finding the widget below the mouse then only requires checking the widgets in a single cell,
+    // and drawing only requires checking the widgets in the cells that overlap with the visible area.
+    struct Container::SpatialIndex
+    {
+        struct Entry
+        {
+            std::size_t index;
+            FloatRect bounds;
+            bool bounded;
+        };
+
+        bool outdated = true;
+        FloatRect area;
+        Vector2f cellSize;
+        std::size_t columns = 0;
+        std::size_t rows = 0;
+        std::vector<std::vector<std::size_t>> cells; // Sorted on index, so in the order in which the widgets are drawn
+        std::vector<std::size_t> unboundedWidgets; // Widgets that have to be checked for every mouse position and always drawn
+        std::unordered_map<const Widget*, Entry> entries;
+        std::vector<const Widget*> changedWidgets; // Widgets that may have been moved or resized since the index was used
+        std::vector<std::size_t> visibleWidgets; // Reused by getWidgetsInArea to not allocate memory every frame
+
+        // Only widgets that don't handle the mouse or draw outside their bounds can be stored in the cells
+        static bool isBounded(const Widget& widget)
+        {
+            return widget.isMouseOnWidgetWithinBounds() && widget.isDrawnWithinBounds();
+        }
+
+        std::size_t getColumn(float x) const
+        {
+            return std::min(columns - 1, static_cast<std::size_t>(std::max(0.f, (x - area.left) / cellSize.x)));
+        }
+
+        std::size_t getRow(float y) const
+        {
+            return std::min(rows - 1, static_cast<std::size_t>(std::max(0.f, (y - area.top) / cellSize.y)));
+        }
+
+        void addToCells(std::size_t index, const FloatRect& bounds)
+        {
+            for (std::size_t row = getRow(bounds.top); row <= getRow(bounds.top + bounds.height); ++row)
+            {
+                for (std::size_t column = getColumn(bounds.left); column <= getColumn(bounds.left + bounds.width); ++column)
+                {
+                    auto& cell = cells[row * columns + column];
+                    cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+                }
+            }
+        }
+
+        void removeFromCells(std::size_t index, const FloatRect& bounds)
+        {
+            for (std::size_t row = getRow(bounds.top); row <= getRow(bounds.top + bounds.height); ++row)
+            {
+                for (std::size_t column = getColumn(bounds.left); column <= getColumn(bounds.left + bounds.width); ++column)
+                {
+                    auto& cell = cells[row * columns + column];
+                    const auto it = std::lower_bound(cell.begin(), cell.end(), index);
+                    if ((it != cell.end()) && (*it == index))
+                        cell.erase(it);
+                }
+            }
+        }
+
+        // Returns the widgets that might be below the mouse, or nullptr when the position lies outside all indexed widgets
+        const std::vector<std::size_t>* getCell(Vector2f pos) const
+        {
+            if ((columns == 0) || (pos.x < area.left) || (pos.y < area.top)
+             || (pos.x > area.left + area.width) || (pos.y > area.top + area.height))
+                return nullptr;
+
+            return &cells[getRow(pos.y) * columns + getColumn(pos.x)];
+        }
+
+        // Returns the widgets that might overlap with the area, sorted in the order in which they are drawn
+        const std::vector<std::size_t>& getWidgetsInArea(const FloatRect& visibleArea)
+        {
+            visibleWidgets = unboundedWidgets;
+
+            if ((columns > 0) && (visibleArea.left <= area.left + area.width) && (visibleArea.top <= area.top + area.height)
+             && (visibleArea.left + visibleArea.width >= area.left) && (visibleArea.top + visibleArea.height >= area.top))
+            {
+                for (std::size_t row = getRow(visibleArea.top); row <= getRow(visibleArea.top + visibleArea.height); ++row)
+                {
+                    for (std::size_t column = getColumn(visibleArea.left); column <= getColumn(visibleArea.left + visibleArea.width); ++column)
+                    {
+                        const auto& cell = cells[row * columns + column];
+                        visibleWidgets.insert(visibleWidgets.end(), cell.begin(), cell.end());
+                    }
+                }
+            }
+
+            // A widget that overlaps with several cells is only drawn once
+            std::sort(visibleWidgets.begin(), visibleWidgets.end());
+            visibleWidgets.erase(std::unique(visibleWidgets.begin(), visibleWidgets.end()), visibleWidgets.end());
+            return visibleWidgets;
+        }
+
+        void rebuild(const std::vector<Widget::Ptr>& widgets)
+        {
+            outdated = false;
+            entries.clear();
+            cells.clear();
+            unboundedWidgets.clear();
+            changedWidgets.clear();
+
+            Vector2f topLeft;
+            Vector2f bottomRight;
+            std::size_t boundedWidgetCount = 0;
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+            {
+                const FloatRect bounds = getWidgetBounds(*widgets[i]);
+                const bool bounded = isBounded(*widgets[i]);
+                entries[widgets[i].get()] = {i, bounds, bounded};
+
+                if (!bounded)
+                {
+                    unboundedWidgets.push_back(i);
+                    continue;
+                }
+
+                if (boundedWidgetCount == 0)
+                {
+                    topLeft = {bounds.left, bounds.top};
+                    bottomRight = {bounds.left + bounds.width, bounds.top + bounds.height};
+                }
+                else
+                {
+                    topLeft.x = std::min(topLeft.x, bounds.left);
+                    topLeft.y = std::min(topLeft.y, bounds.top);
+                    bottomRight.x = std::max(bottomRight.x, bounds.left + bounds.width);
+                    bottomRight.y = std::max(bottomRight.y, bounds.top + bounds.height);
+                }
+
+                ++boundedWidgetCount;
+            }
+
+            if (boundedWidgetCount == 0)
+            {
+                columns = 0;
+                rows = 0;
+                return;
+            }
+
+            // Use roughly one cell per widget
+            const auto cellsPerSide = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(boundedWidgetCount))));
+            area = {topLeft, bottomRight - topLeft};
+            columns = (area.width > 0) ? cellsPerSide : 1;
+            rows = (area.height > 0) ? cellsPerSide : 1;
+            cellSize = {(area.width > 0) ? (area.width / columns) : 1.f, (area.height > 0) ? (area.height / rows) : 1.f};
+            cells.resize(columns * rows);
+
+            for (const auto& widget : widgets)
+            {
+                const Entry& entry = entries[widget.get()];
+                if (entry.bounded)
+                    addToCells(entry.index, entry.bounds);
+            }
+        }
+
+        // Moves a widget to the correct cells. Returns false when the index has to be rebuilt instead.
+        bool update(const Widget& widget)
+        {
+            const auto it = entries.find(&widget);
+            if (it == entries.end())
+                return false;
+
+            Entry& entry = it->second;
+            if (isBounded(widget) != entry.bounded)
+                return false;
+            if (!entry.bounded)
+                return true;
+
+            const FloatRect bounds = getWidgetBounds(widget);
+            if (bounds == entry.bounds)
+                return true;
+
+            // The cells only cover the area in which the widgets were located when the index was built
+            if ((bounds.left < area.left) || (bounds.top < area.top)
+             || (bounds.left + bounds.width > area.left + area.width) || (bounds.top + bounds.height > area.top + area.height))
+                return false;
+
+            removeFromCells(entry.index, entry.bounds);
+            entry.bounds = bounds;
+            addToCells(entry.index, entry.bounds);
+            return true;
+        }
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     namespace
@@ -110,6 +337,9 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>();
+
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgets[i]->getWidgetName());
@@ -122,7 +352,8 @@ namespace tgui
         m_widgets             {std::move(other.m_widgets)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_spatialIndex        {std::move(other.m_spatialIndex)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -156,6 +387,11 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            if (right.m_spatialIndex)
+                m_spatialIndex = std::make_unique<SpatialIndex>();
+            else
+                m_spatialIndex = nullptr;
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
@@ -179,6 +415,7 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_spatialIndex         = std::move(right.m_spatialIndex);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -205,7 +442,7 @@ namespace tgui
             {
                 m_prevInnerSize = getInnerSize();
                 for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                    layout->boundWidgetChanged();
             }
         }
     }
@@ -219,9 +456,12 @@ namespace tgui
         if (widgetPtr->getParent())
             widgetPtr->getParent()->remove(widgetPtr);
 
+        // The name is set before the parent, so that the widget only has to be registered in the signal manager once
+        widgetPtr->setWidgetName(widgetName);
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
-        widgetPtr->setWidgetName(widgetName);
+        spatialIndexChanged();
+        widgetPtr->invalidate();
 
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
@@ -235,6 +475,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::addBulk(const std::vector<Widget::Ptr>& widgets)
+    {
+        if (widgets.empty())
+            return;
+
+        m_widgets.reserve(m_widgets.size() + widgets.size());
+
+        beginUpdate();
+        for (const auto& widget : widgets)
+            add(widget);
+        endUpdate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::beginUpdate()
+    {
+        ++m_updateNestingLevel;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::endUpdate()
+    {
+        assert(m_updateNestingLevel > 0);
+        if (--m_updateNestingLevel > 0)
+            return;
+
+        if (m_widgetUpdatePostponed)
+        {
+            m_widgetUpdatePostponed = false;
+            postponedUpdateWidgets();
+        }
+
+        // Redraw the whole container once instead of redrawing the area of every changed widget separately
+        if (m_redrawPostponed)
+        {
+            m_redrawPostponed = false;
+            childInvalidated({getAbsolutePosition(), getFullSize()});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isUpdating() const
+    {
+        return m_updateNestingLevel > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -279,8 +570,10 @@ namespace tgui
                 }
 
                 // Remove the widget
+                widget->invalidate();
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
+                spatialIndexChanged();
                 return true;
             }
         }
@@ -293,9 +586,13 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidate();
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
+        spatialIndexChanged();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
@@ -366,13 +663,30 @@ namespace tgui
 
     void Container::loadWidgetsFromFile(const std::string& filename, bool replaceExisting)
     {
-        std::ifstream in{filename};
+        // The file is opened in binary mode as it could be a compiled widget file
+        std::ifstream in{filename, std::ios_base::binary};
         if (!in.is_open())
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream, replaceExisting);
+        // Read the whole file at once and parse it directly from memory
+        std::string contents;
+        in.seekg(0, std::ios_base::end);
+        const auto fileSize = in.tellg();
+        if (fileSize > 0)
+        {
+            contents.resize(static_cast<std::size_t>(fileSize));
+            in.seekg(0, std::ios_base::beg);
+            in.read(&contents[0], fileSize);
+            contents.resize(static_cast<std::size_t>(in.gcount()));
+        }
+        else // The size of the file is unknown
+        {
+            in.clear();
+            in.seekg(0, std::ios_base::beg);
+            contents.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+        }
+
+        loadWidgetsFromNodeTree(DataIO::parse(contents.data(), contents.size()), replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,10 +705,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        std::stringstream stream;
+        saveWidgetsToBinaryStream(stream);
+
+        std::ofstream out{filename, std::ios_base::binary};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+
+        out << stream.rdbuf();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream), replaceExisting);
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
+    {
+        loadWidgetsFromStream(stream, replaceExisting);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting)
+    {
         // Replace the existing widgets by the ones that will be loaded if requested
         if (replaceExisting)
             removeAllWidgets();
@@ -434,14 +774,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
+    void Container::saveWidgetsToStream(std::stringstream& stream) const
     {
-        loadWidgetsFromStream(stream, replaceExisting);
+        DataIO::emit(saveWidgetsToNodeTree(), stream);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    void Container::saveWidgetsToBinaryStream(std::stringstream& stream) const
+    {
+        DataIO::emitBinary(saveWidgetsToNodeTree(), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree() const
     {
         auto node = std::make_unique<DataIO::Node>();
 
@@ -470,7 +817,7 @@ namespace tgui
         for (const auto& child : getWidgets())
             node->children.emplace_back(child->save(renderersMap));
 
-        DataIO::emit(node, stream);
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,6 +835,8 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
+            spatialIndexChanged();
+            widget->invalidate();
             break;
         }
     }
@@ -508,12 +857,31 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
+            spatialIndexChanged();
+            widget->invalidate();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled && !m_spatialIndex)
+            m_spatialIndex = std::make_unique<SpatialIndex>();
+        else if (!enabled)
+            m_spatialIndex = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -624,6 +992,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childInvalidated(const FloatRect& area)
+    {
+        if (m_updateNestingLevel > 0)
+        {
+            m_redrawPostponed = true;
+            return;
+        }
+
+        // Changes to widgets inside a hidden container don't have to be drawn
+        if (m_parent && m_visible)
+            m_parent->childInvalidated(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childChanged(const Widget& child)
+    {
+        if (!m_spatialIndex || m_spatialIndex->outdated)
+            return;
+
+        auto& changedWidgets = m_spatialIndex->changedWidgets;
+        if (!changedWidgets.empty() && (changedWidgets.back() == &child))
+            return;
+
+        // Rebuilding the index is cheaper than updating it for most of its widgets
+        if (changedWidgets.size() >= m_widgets.size())
+            spatialIndexChanged();
+        else
+            changedWidgets.push_back(&child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -895,6 +1296,11 @@ namespace tgui
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
                         widget->mouseMoved(mousePos);
+
+                        // Dragging the mouse changes e.g. the thumb position or selection, child widgets invalidate themselves
+                        if (!widget->isContainer())
+                            widget->invalidate();
+
                         return true;
                     }
                 }
@@ -906,6 +1312,12 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseMoved(mousePos);
+
+                // A widget that only hovers doesn't have to be redrawn unless it invalidated itself, but when the mouse
+                // is held down the move may for example change the selected text
+                if (widget->m_mouseDown && !widget->isContainer())
+                    widget->invalidate();
+
                 return true;
             }
 
@@ -939,6 +1351,10 @@ namespace tgui
                 else // Touch began of finger 0
                     widget->mousePressed(sf::Mouse::Button::Left, mousePos);
 
+                // Containers pass the event on to their child widgets which will invalidate themselves
+                if (!widget->isContainer())
+                    widget->invalidate();
+
                 return true;
             }
             else // The mouse did not went down on a widget, so unfocus the focused child widget, but keep ourselves focused
@@ -970,6 +1386,10 @@ namespace tgui
                     widgetBelowMouse->mouseReleased(event.mouseButton.button, mousePos);
                 else
                     widgetBelowMouse->mouseReleased(sf::Mouse::Button::Left, mousePos);
+
+                // Releasing the mouse on a widget changes how it looks
+                if (!widgetBelowMouse->isContainer())
+                    widgetBelowMouse->invalidate();
             }
 
             if (((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Left))
@@ -982,7 +1402,13 @@ namespace tgui
                 {
                     // TODO: Only call leftMouseButtonNoLongerDown on the widget that last got the left mouse down event
                     for (auto& widget : m_widgets)
+                    {
+                        // A widget on which the mouse went down looks different while it is pressed
+                        const bool wasMouseDown = widget->m_mouseDown;
                         widget->leftMouseButtonNoLongerDown();
+                        if (wasMouseDown && !widget->isContainer())
+                            widget->invalidate();
+                    }
                 }
             }
             else if ((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button == sf::Mouse::Right))
@@ -1018,6 +1444,11 @@ namespace tgui
 
                     // Tell the widget that the key was pressed
                     m_focusedWidget->keyPressed(event.key);
+
+                    // Keys move the caret or change the selection, which the widget doesn't report itself
+                    if (m_focusedWidget && !m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     return true;
                 }
             }
@@ -1035,6 +1466,10 @@ namespace tgui
                 if (m_focusedWidget && m_focusedWidget->isFocused())
                 {
                     m_focusedWidget->textEntered(event.text.unicode);
+
+                    if (m_focusedWidget && !m_focusedWidget->isContainer())
+                        m_focusedWidget->invalidate();
+
                     return true;
                 }
             }
@@ -1048,7 +1483,13 @@ namespace tgui
             // Send the event to the widget below the mouse
             Widget::Ptr widget = mouseOnWhichWidget({static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
             if (widget != nullptr)
-                return widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+            {
+                const bool handled = widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+                if (handled && !widget->isContainer())
+                    widget->invalidate();
+
+                return handled;
+            }
 
             return false;
         }
@@ -1061,19 +1502,49 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            updateSpatialIndex();
+
+            // Only the widgets in the cell below the mouse and the widgets that aren't stored in cells have to be checked.
+            // Both lists are sorted, so they are merged to check the widgets from front to back, just like the loop below.
+            const std::vector<std::size_t>* cellWidgets = m_spatialIndex->getCell(mousePos);
+            const std::vector<std::size_t>& unboundedWidgets = m_spatialIndex->unboundedWidgets;
+            std::size_t cellPos = cellWidgets ? cellWidgets->size() : 0;
+            std::size_t unboundedPos = unboundedWidgets.size();
+            while ((cellPos > 0) || (unboundedPos > 0))
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                std::size_t index;
+                if ((unboundedPos == 0) || ((cellPos > 0) && ((*cellWidgets)[cellPos - 1] > unboundedWidgets[unboundedPos - 1])))
+                    index = (*cellWidgets)[--cellPos];
+                else
+                    index = unboundedWidgets[--unboundedPos];
+
+                if (m_widgets[index]->isVisible() && m_widgets[index]->mouseOnWidget(mousePos))
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if (m_widgets[index]->isEnabled())
+                        widget = m_widgets[index];
 
                     break;
                 }
             }
         }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if ((*it)->isVisible())
+                {
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
+
+                        break;
+                    }
+                }
+            }
+        }
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
@@ -1085,14 +1556,101 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::spatialIndexChanged()
+    {
+        if (m_spatialIndex)
+        {
+            m_spatialIndex->outdated = true;
+            m_spatialIndex->changedWidgets.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateSpatialIndex() const
+    {
+        if (!m_spatialIndex->outdated)
+        {
+            for (const Widget* widget : m_spatialIndex->changedWidgets)
+            {
+                if (!m_spatialIndex->update(*widget))
+                {
+                    m_spatialIndex->outdated = true;
+                    break;
+                }
+            }
+
+            m_spatialIndex->changedWidgets.clear();
+        }
+
+        if (m_spatialIndex->outdated)
+            m_spatialIndex->rebuild(m_widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::postponeUpdateWidgets()
+    {
+        if (m_updateNestingLevel == 0)
+            return false;
+
+        m_widgetUpdatePostponed = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::postponedUpdateWidgets()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Draw all widgets when they are visible
-        for (const auto& widget : m_widgets)
+        // Widgets that lie completely outside the visible area (e.g. because they are clipped or scrolled away) are skipped
+        const FloatRect visibleArea = getVisibleArea(*target, states.transform);
+        const auto isWidgetVisible = [&visibleArea](const Widget& widget)
+            {
+                if (!widget.isVisible())
+                    return false;
+
+                if (!widget.isDrawnWithinBounds())
+                    return true;
+
+                const Vector2f pos = widget.getPosition() + widget.getWidgetOffset();
+                const Vector2f size = widget.getFullSize();
+                return (pos.x <= visibleArea.left + visibleArea.width) && (pos.x + size.x >= visibleArea.left)
+                    && (pos.y <= visibleArea.top + visibleArea.height) && (pos.y + size.y >= visibleArea.top);
+            };
+
+        // With the spatial index, only the widgets in the cells that overlap with the visible area have to be checked
+        if (m_spatialIndex)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            updateSpatialIndex();
+
+            for (const std::size_t index : m_spatialIndex->getWidgetsInArea(visibleArea))
+            {
+                if (isWidgetVisible(*m_widgets[index]))
+                    m_widgets[index]->draw(*target, states);
+            }
         }
+        else
+        {
+            // Draw all widgets when they are visible
+            for (const auto& widget : m_widgets)
+            {
+                if (isWidgetVisible(*widget))
+                    widget->draw(*target, states);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isDrawnWithinBounds() const
+    {
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1180,6 +1738,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::childInvalidated(const FloatRect& area)
+    {
+        if (m_updateNestingLevel > 0)
+        {
+            m_redrawPostponed = true;
+            return;
+        }
+
+        if (m_redrawNeeded)
+        {
+            const float right = std::max(m_invalidatedArea.left + m_invalidatedArea.width, area.left + area.width);
+            const float bottom = std::max(m_invalidatedArea.top + m_invalidatedArea.height, area.top + area.height);
+            m_invalidatedArea.left = std::min(m_invalidatedArea.left, area.left);
+            m_invalidatedArea.top = std::min(m_invalidatedArea.top, area.top);
+            m_invalidatedArea.width = right - m_invalidatedArea.left;
+            m_invalidatedArea.height = bottom - m_invalidatedArea.top;
+        }
+        else
+        {
+            m_invalidatedArea = area;
+            m_redrawNeeded = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiContainer::isRedrawNeeded() const
+    {
+        return m_redrawNeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect GuiContainer::getInvalidatedArea() const
+    {
+        return m_invalidatedArea;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::redrawFinished()
+    {
+        m_redrawNeeded = false;
+        m_invalidatedArea = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
@@ -121,6 +121,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isMouseOnWidgetWithinBounds() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CustomWidgetForBindings::leftMousePressed(Vector2f pos)
     {
         Widget::leftMousePressed(pos);
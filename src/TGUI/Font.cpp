@@ -26,7 +26,12 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <unordered_map>
 #include <cassert>
+#include <cstring>
+#include <array>
+#include <mutex>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,6 +39,126 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    struct Font::GlyphMetricsCache
+    {
+        struct SizeMetrics
+        {
+            // Advances of the characters in the Basic Multilingual Plane, in pages of 256 characters that are allocated when used.
+            // A negative value means that the advance wasn't looked up yet.
+            std::array<std::unique_ptr<std::array<float, 256>>, 256> bmpAdvances;
+
+            std::unordered_map<std::uint32_t, float> otherAdvances;
+            std::unordered_map<std::uint64_t, float> kernings;
+
+            // Glyphs by code point and outline thickness, scaled to this character size when a reference size is used
+            std::unordered_map<std::uint64_t, sf::Glyph> glyphs;
+        };
+
+        SizeMetrics& getSizeMetrics(unsigned int characterSize, bool bold)
+        {
+            // Text is measured character by character with the same size and style, so remember the last lookup
+            if (!lastSizeMetrics || (lastCharacterSize != characterSize) || (lastBold != bold))
+            {
+                lastSizeMetrics = &sizeMetrics[bold ? 1 : 0][characterSize];
+                lastCharacterSize = characterSize;
+                lastBold = bold;
+            }
+
+            return *lastSizeMetrics;
+        }
+
+        float getScale(unsigned int characterSize) const
+        {
+            if (referenceSize == 0)
+                return 1;
+            else
+                return static_cast<float>(characterSize) / referenceSize;
+        }
+
+        const sf::Glyph& getGlyph(const sf::Font& font, std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+        {
+            std::uint32_t outlineBits;
+            std::memcpy(&outlineBits, &outlineThickness, sizeof(outlineBits));
+
+            auto& glyphs = getSizeMetrics(characterSize, bold).glyphs;
+            const std::uint64_t key = (static_cast<std::uint64_t>(outlineBits) << 32) | codePoint;
+            const auto it = glyphs.find(key);
+            if (it != glyphs.end())
+                return it->second;
+
+            sf::Glyph glyph;
+            if ((referenceSize == 0) || (characterSize == referenceSize))
+            {
+            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                glyph = font.getGlyph(codePoint, characterSize, bold, outlineThickness);
+            #else
+                (void)outlineThickness;
+                glyph = font.getGlyph(codePoint, characterSize, bold);
+            #endif
+
+                renderedSizes.insert(characterSize);
+                ++renderedGlyphs;
+            }
+            else
+            {
+                // Take the glyph from the reference size and only scale its metrics, the texture rect stays the same
+                const float scale = getScale(characterSize);
+                glyph = getGlyph(font, codePoint, referenceSize, bold, outlineThickness / scale);
+                glyph.advance *= scale;
+                glyph.bounds = {glyph.bounds.left * scale, glyph.bounds.top * scale, glyph.bounds.width * scale, glyph.bounds.height * scale};
+            }
+
+            return glyphs.emplace(key, glyph).first->second;
+        }
+
+        std::unordered_map<unsigned int, SizeMetrics> sizeMetrics[2]; // Regular and bold
+        SizeMetrics* lastSizeMetrics = nullptr;
+        unsigned int lastCharacterSize = 0;
+        bool lastBold = false;
+
+        unsigned int referenceSize = 0;
+        std::set<unsigned int> renderedSizes; // Character sizes for which the font created a glyph texture
+        std::size_t renderedGlyphs = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Font::GlyphMetricsCache> Font::getGlyphMetricsCache(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        struct CacheEntry
+        {
+            std::weak_ptr<sf::Font> font;
+            std::shared_ptr<GlyphMetricsCache> cache;
+        };
+
+        // The cache lives as long as the SFML font, so that e.g. every call to getGlobalFont() returns a font with the same cache
+        static std::mutex mutex;
+        static std::unordered_map<const sf::Font*, CacheEntry> caches;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = caches.find(font.get());
+        if ((it != caches.end()) && !it->second.font.expired())
+            return it->second.cache;
+
+        // Forget the caches of destroyed fonts, one of them may even have had the same address as this font
+        for (auto entryIt = caches.begin(); entryIt != caches.end();)
+        {
+            if (entryIt->second.font.expired())
+                entryIt = caches.erase(entryIt);
+            else
+                ++entryIt;
+        }
+
+        auto cache = std::make_shared<GlyphMetricsCache>();
+        caches[font.get()] = {font, cache};
+        return cache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Font::Font(std::nullptr_t)
     {
     }
@@ -42,7 +167,8 @@ namespace tgui
 
     Font::Font(const std::string& id) :
         m_font(Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()), // Did not compile with clang 3.6 when using braces
-        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()) // Did not compile with clang 3.6 when using braces
+        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()), // Did not compile with clang 3.6 when using braces
+        m_glyphMetricsCache{getGlyphMetricsCache(m_font)}
     {
     }
 
@@ -56,21 +182,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::shared_ptr<sf::Font>& font) :
-        m_font{font}
+        m_font{font},
+        m_glyphMetricsCache{getGlyphMetricsCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font{std::make_shared<sf::Font>(font)},
+        m_glyphMetricsCache{getGlyphMetricsCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const void* data, std::size_t sizeInBytes) :
-        m_font{std::make_shared<sf::Font>()}
+        m_font{std::make_shared<sf::Font>()},
+        m_glyphMetricsCache{getGlyphMetricsCache(m_font)}
     {
         m_font->loadFromMemory(data, sizeInBytes);
     }
@@ -79,7 +208,8 @@ namespace tgui
 
     Font::Font(const Font& other) :
         m_font{other.m_font},
-        m_id{other.m_id}
+        m_id{other.m_id},
+        m_glyphMetricsCache{other.m_glyphMetricsCache}
     {
     }
 
@@ -87,9 +217,11 @@ namespace tgui
 
     Font::Font(Font&& other) :
         m_font{std::move(other.m_font)},
-        m_id{std::move(other.m_id)}
+        m_id{std::move(other.m_id)},
+        m_glyphMetricsCache{std::move(other.m_glyphMetricsCache)}
     {
         other.m_font = nullptr;
+        other.m_glyphMetricsCache = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +236,7 @@ namespace tgui
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_glyphMetricsCache = other.m_glyphMetricsCache;
         }
 
         return *this;
@@ -121,8 +254,10 @@ namespace tgui
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_glyphMetricsCache = std::move(other.m_glyphMetricsCache);
 
             other.m_font = nullptr;
+            other.m_glyphMetricsCache = nullptr;
         }
 
         return *this;
@@ -198,36 +333,152 @@ namespace tgui
     const sf::Glyph& Font::getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness) const
     {
         assert(m_font != nullptr);
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
-    #else
-        (void)outlineThickness;
-        return m_font->getGlyph(codePoint, characterSize, bold);
-    #endif
+        return m_glyphMetricsCache->getGlyph(*m_font, codePoint, characterSize, bold, outlineThickness);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getKerning(first, second, characterSize);
-        else
+        if (!m_font)
+            return 0;
+
+        // There is no kerning with the null character, which is passed in front of the first character of a text
+        if ((first == 0) || (second == 0))
             return 0;
+
+        // Kerning doesn't depend on the style, but the last used style is passed to not alternate between the cached sizes
+        auto& kernings = m_glyphMetricsCache->getSizeMetrics(characterSize, m_glyphMetricsCache->lastBold).kernings;
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+        const auto it = kernings.find(key);
+        if (it != kernings.end())
+            return it->second;
+
+        float kerning;
+        if (m_glyphMetricsCache->referenceSize == 0)
+            kerning = m_font->getKerning(first, second, characterSize);
+        else
+            kerning = m_font->getKerning(first, second, m_glyphMetricsCache->referenceSize) * m_glyphMetricsCache->getScale(characterSize);
+
+        kernings[key] = kerning;
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Font::getGlyphAdvance(std::uint32_t codePoint, unsigned int characterSize, bool bold) const
+    {
+        assert(m_font != nullptr);
+
+        auto& sizeMetrics = m_glyphMetricsCache->getSizeMetrics(characterSize, bold);
+        if (codePoint < 0x10000)
+        {
+            auto& page = sizeMetrics.bmpAdvances[codePoint >> 8];
+            if (!page)
+            {
+                page = std::make_unique<std::array<float, 256>>();
+                page->fill(-1);
+            }
+
+            float& advance = (*page)[codePoint & 0xFF];
+            if (advance < 0)
+                advance = m_glyphMetricsCache->getGlyph(*m_font, codePoint, characterSize, bold, 0).advance;
+
+            return advance;
+        }
+        else
+        {
+            const auto it = sizeMetrics.otherAdvances.find(codePoint);
+            if (it != sizeMetrics.otherAdvances.end())
+                return it->second;
+
+            const float advance = m_glyphMetricsCache->getGlyph(*m_font, codePoint, characterSize, bold, 0).advance;
+            sizeMetrics.otherAdvances[codePoint] = advance;
+            return advance;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getLineSpacing(unsigned int characterSize) const
     {
-        if (m_font)
+        if (!m_font)
+            return 0;
+
+        if (m_glyphMetricsCache->referenceSize == 0)
             return m_font->getLineSpacing(characterSize);
+        else
+            return m_font->getLineSpacing(m_glyphMetricsCache->referenceSize) * m_glyphMetricsCache->getScale(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& Font::getTexture(unsigned int characterSize) const
+    {
+        assert(m_font != nullptr);
+
+        if (m_glyphMetricsCache->referenceSize == 0)
+            return m_font->getTexture(characterSize);
+        else
+            return m_font->getTexture(m_glyphMetricsCache->referenceSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setGlyphReferenceSize(unsigned int characterSize)
+    {
+        assert(m_font != nullptr);
+
+        if (m_glyphMetricsCache->referenceSize == characterSize)
+            return;
+
+        // All cached metrics are for the old reference size
+        m_glyphMetricsCache->referenceSize = characterSize;
+        m_glyphMetricsCache->sizeMetrics[0].clear();
+        m_glyphMetricsCache->sizeMetrics[1].clear();
+        m_glyphMetricsCache->lastSizeMetrics = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Font::getGlyphReferenceSize() const
+    {
+        if (m_glyphMetricsCache)
+            return m_glyphMetricsCache->referenceSize;
         else
             return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Font::getGlyphScale(unsigned int characterSize) const
+    {
+        if (m_glyphMetricsCache)
+            return m_glyphMetricsCache->getScale(characterSize);
+        else
+            return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font::GlyphCacheStats Font::getGlyphCacheStats() const
+    {
+        GlyphCacheStats stats;
+        if (!m_font)
+            return stats;
+
+        stats.textureCount = m_glyphMetricsCache->renderedSizes.size();
+        stats.renderedGlyphs = m_glyphMetricsCache->renderedGlyphs;
+        for (const unsigned int characterSize : m_glyphMetricsCache->renderedSizes)
+        {
+            const sf::Vector2u textureSize = m_font->getTexture(characterSize).getSize();
+            stats.textureBytes += static_cast<std::size_t>(textureSize.x) * textureSize.y * 4;
+        }
+
+        return stats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Clipping.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
 #include <cassert>
 
@@ -132,12 +133,16 @@ namespace tgui
 
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
+            m_container->childInvalidated({view.getCenter() - (view.getSize() / 2.f), view.getSize()});
 
             for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
         else // Set it anyway in case something changed that we didn't care to check
+        {
             m_view = view;
+            m_container->childInvalidated({view.getCenter() - (view.getSize() / 2.f), view.getSize()});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,6 +251,7 @@ namespace tgui
         #endif
         }
 
+        // Widgets invalidate themselves when the event changes how they look
         return m_container->handleEvent(event);
     }
 
@@ -283,22 +289,114 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
-        // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
+        updateTime();
+
+        const sf::View oldView = m_target->getView();
+        if (m_drawCachingEnabled)
+        {
+            // The cached frame has to have the same size as the target to get the same result as when drawing on the target
+            const sf::Vector2u targetSize = m_target->getSize();
+            if (!m_cachedFrame || (m_cachedFrame->getSize() != targetSize))
+            {
+                m_cachedFrame = std::make_unique<sf::RenderTexture>();
+                if (m_cachedFrame->create(targetSize.x, targetSize.y))
+                    m_container->childInvalidated({m_view.getCenter() - (m_view.getSize() / 2.f), m_view.getSize()});
+                else
+                    m_cachedFrame = nullptr;
+            }
+        }
+
+        // The widgets are drawn directly on the target when the cached frame couldn't be created
+        if (m_drawCachingEnabled && m_cachedFrame)
+        {
+            unsigned int drawCallCount = 0;
+            if (m_container->isRedrawNeeded())
+            {
+                m_cachedFrame->clear(sf::Color::Transparent);
+                drawWidgets(*m_cachedFrame);
+                m_cachedFrame->display();
+                drawCallCount = m_drawCallCount;
+            }
+
+            // The colors in the render texture are already multiplied with their alpha value
+            m_target->setView(m_target->getDefaultView());
+            m_target->draw(sf::Sprite{m_cachedFrame->getTexture()}, sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha});
+            m_drawCallCount = drawCallCount + 1;
+        }
         else
-            m_clock.restart();
+            drawWidgets(*m_target);
+
+        m_container->redrawFinished();
 
+        // Restore the old view
+        m_target->setView(oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets(sf::RenderTarget& target)
+    {
         // Change the view
-        const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
+        target.setView(m_view);
         Clipping::setGuiView(m_view);
 
         // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        m_renderBatch.begin(target, m_drawBatchingEnabled);
+        m_container->drawWidgetContainer(&target, sf::RenderStates::Default);
+        m_renderBatch.end();
 
-        // Restore the old view
-        m_target->setView(oldView);
+        m_drawCallCount = m_renderBatch.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setDrawBatchingEnabled(bool enabled)
+    {
+        m_drawBatchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawBatchingEnabled() const
+    {
+        return m_drawBatchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getDrawCallCount() const
+    {
+        return m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return m_container->isRedrawNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Gui::getInvalidatedArea() const
+    {
+        return m_container->getInvalidatedArea();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setDrawCachingEnabled(bool enabled)
+    {
+        m_drawCachingEnabled = enabled;
+        if (!enabled)
+            m_cachedFrame = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawCachingEnabled() const
+    {
+        return m_drawCachingEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,6 +450,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::addBulk(const std::vector<Widget::Ptr>& widgets)
+    {
+        m_container->addBulk(widgets);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Gui::get(const sf::String& widgetName) const
     {
         return m_container->get(widgetName);
@@ -485,6 +590,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        m_container->saveWidgetsToBinaryFile(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
         m_container->loadWidgetsFromStream(stream, replaceExisting);
@@ -506,8 +618,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::saveWidgetsToBinaryStream(std::stringstream& stream) const
+    {
+        m_container->saveWidgetsToBinaryStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        // Apply the changes that other threads made to widgets
+        m_commandQueue.execute();
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
@@ -533,6 +655,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::updateTime()
+    {
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+        {
+            // Changes from other threads are still applied while the animations are paused
+            m_commandQueue.execute();
+            m_clock.restart();
+        }
+
+        // Widgets may still have to be moved or resized before they can be drawn.
+        // This is done after updating the time so that layouts depending on animated widgets don't lag a frame behind.
+        updateLayouts();
+
+        return needsRedraw();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateLayouts()
+    {
+        Layout::updateDeferredLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue& Gui::getCommandQueue()
+    {
+        return m_commandQueue;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -29,11 +29,50 @@
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
+#include <mutex>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    bool Layout::m_deferredUpdatesEnabled = false;
+    std::unordered_set<Layout*> Layout::m_dirtyLayouts;
+    std::unordered_set<const Widget*> Layout::m_widgetsPendingUpdate;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Layout::Program
+    {
+        struct Instruction
+        {
+            Operation operation;        // Value, a math operation or BindingString to load the value of a binding
+            float value;                // The constant to load in case the operation is Value
+            std::size_t bindingIndex;   // The binding to load in case the operation is BindingString
+        };
+
+        std::vector<Instruction> instructions; // The instructions in postfix order
+        std::vector<std::string> bindingStrings; // String referring to a widget for each binding, empty if the binding was created with a bind function
+        std::size_t stackSize = 0; // Maximum amount of values that are on the stack while executing the instructions
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Parsed expressions are kept around, so that layouts created from the same string can share the parsed program
+        const std::size_t maxCachedExpressions = 4096;
+        std::mutex expressionCacheMutex;
+
+        std::unordered_map<std::string, Layout>& getExpressionCache()
+        {
+            static std::unordered_map<std::string, Layout> expressionCache;
+            return expressionCache;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     static std::pair<std::string, std::string> parseMinMaxExpresssion(const std::string& expression)
     {
         unsigned int bracketCount = 0;
@@ -64,6 +103,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Find the widget corresponding to the given name. Returns false if the widget was not found.
+    static bool parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Layout::Operation& operation, Widget*& boundWidget)
+    {
+        if (expression == "x" || expression == "left")
+            operation = Layout::Operation::BindingLeft;
+        else if (expression == "y" || expression == "top")
+            operation = Layout::Operation::BindingTop;
+        else if (expression == "w" || expression == "width")
+            operation = Layout::Operation::BindingWidth;
+        else if (expression == "h" || expression == "height")
+            operation = Layout::Operation::BindingHeight;
+        else if (expression == "iw" || expression == "innerwidth")
+            operation = Layout::Operation::BindingInnerWidth;
+        else if (expression == "ih" || expression == "innerheight")
+            operation = Layout::Operation::BindingInnerHeight;
+        else if (expression == "size")
+            return parseBindingString(xAxis ? "width" : "height", widget, xAxis, operation, boundWidget);
+        else if (expression == "innersize")
+            return parseBindingString(xAxis ? "innerwidth" : "innerheight", widget, xAxis, operation, boundWidget);
+        else if ((expression == "pos") || (expression == "position"))
+            return parseBindingString(xAxis ? "x" : "y", widget, xAxis, operation, boundWidget);
+        else
+        {
+            const auto dotPos = expression.find('.');
+            if (dotPos != std::string::npos)
+            {
+                const std::string widgetName = expression.substr(0, dotPos);
+                if (widgetName == "parent" || widgetName == "&")
+                {
+                    if (widget->getParent())
+                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis, operation, boundWidget);
+                }
+                else if (!widgetName.empty())
+                {
+                    // If the widget is a container, search in its children first
+                    Container* container = dynamic_cast<Container*>(widget);
+                    if (container != nullptr)
+                    {
+                        const auto& widgets = container->getWidgets();
+                        for (std::size_t i = 0; i < widgets.size(); ++i)
+                        {
+                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, operation, boundWidget);
+                        }
+                    }
+
+                    // If the widget has a parent, look for a sibling
+                    if (widget->getParent())
+                    {
+                        const auto& widgets = widget->getParent()->getWidgets();
+                        for (std::size_t i = 0; i < widgets.size(); ++i)
+                        {
+                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, operation, boundWidget);
+                        }
+                    }
+                }
+            }
+
+            // The referred widget was not found or there was something wrong with the string
+            return false;
+        }
+
+        boundWidget = widget;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Layout::Layout(std::string expression)
     {
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
@@ -71,6 +179,46 @@ namespace tgui
         if (expression.empty())
             return;
 
+        // Parsing the same string again would result in the same program, so copy the layout that was created the last time
+        {
+            std::lock_guard<std::mutex> lock(expressionCacheMutex);
+            const auto& expressionCache = getExpressionCache();
+            const auto it = expressionCache.find(expression);
+            if (it != expressionCache.end())
+            {
+                m_value = it->second.m_value;
+                m_program = it->second.m_program;
+                m_bindings = it->second.m_bindings;
+                return;
+            }
+        }
+
+        // The cache isn't locked while parsing, as the sub-expressions are also looked up in the cache
+        parseExpression(expression);
+
+        std::lock_guard<std::mutex> lock(expressionCacheMutex);
+        auto& expressionCache = getExpressionCache();
+        if (expressionCache.size() >= maxCachedExpressions)
+            expressionCache.clear();
+
+        expressionCache.emplace(std::move(expression), *this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::parseExpression(std::string expression)
+    {
+        const auto setBindingString = [this](std::string bindingString)
+            {
+                auto program = std::make_shared<Program>();
+                program->instructions.push_back({Operation::BindingString, 0, 0});
+                program->bindingStrings.push_back(std::move(bindingString));
+                program->stackSize = 1;
+
+                m_program = std::move(program);
+                m_bindings.assign(1, Binding{});
+            };
+
         auto searchPos = expression.find_first_of("+-/*()");
 
         // Extract the value from the string when there are no more operators
@@ -82,8 +230,7 @@ namespace tgui
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
                 {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
+                    setBindingString("&.innersize");
                 }
                 else // value is a fraction of parent size
                 {
@@ -114,8 +261,7 @@ namespace tgui
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    setBindingString(expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
@@ -263,7 +409,7 @@ namespace tgui
                 assert(nextOperandIt != operands.end());
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                if (operandIt->isConstant() && nextOperandIt->isConstant() && (operandIt->m_value == 0))
                 {
                     if (operators[i] == Operation::Minus)
                         nextOperandIt->m_value = -nextOperandIt->m_value;
@@ -287,82 +433,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
-    {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
-        }
-        else if (m_operation == Operation::BindingInnerHeight)
-        {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
-        }
+    Layout::Layout(Operation operation, Widget* boundWidget)
+    {
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
+
+        // All layouts that only consist of a single binding can use the same program
+        static const std::shared_ptr<const Program> bindingProgram = []{
+                auto program = std::make_shared<Program>();
+                program->instructions.push_back({Operation::BindingString, 0, 0});
+                program->bindingStrings.emplace_back();
+                program->stackSize = 1;
+                return program;
+            }();
+
+        m_program = bindingProgram;
+        m_bindings.assign(1, Binding{operation, boundWidget, 0});
 
         resetPointers();
-        recalculateValue();
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand)
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
+        assert(leftOperand != nullptr);
+        assert(rightOperand != nullptr);
+
+        auto program = std::make_shared<Program>();
+        appendOperand(*program, *leftOperand);
+        appendOperand(*program, *rightOperand);
+        program->instructions.push_back({operation, 0, 0});
+
+        // The value of the left operand remains on the stack while the right operand is being calculated
+        const std::size_t leftStackSize = leftOperand->m_program ? leftOperand->m_program->stackSize : 1;
+        const std::size_t rightStackSize = rightOperand->m_program ? rightOperand->m_program->stackSize : 1;
+        program->stackSize = std::max(leftStackSize, rightStackSize + 1);
+
+        m_program = std::move(program);
+
         resetPointers();
-        recalculateValue();
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
-    {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
-
+        m_value   {other.m_value},
+        m_program {other.m_program},
+        m_bindings{other.m_bindings}
+    {
+        resetStringBindings();
         resetPointers();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+        m_value  {std::move(other.m_value)},
+        m_program{std::move(other.m_program)}
     {
+        // The widgets have to be told about the new address of the layout
+        other.unbindLayout();
+        m_bindings = std::move(other.m_bindings);
+        other.m_bindings.clear();
+
         resetPointers();
     }
 
@@ -374,18 +513,11 @@ namespace tgui
         {
             unbindLayout();
 
-            m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
-
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
+            m_value    = other.m_value;
+            m_program  = other.m_program;
+            m_bindings = other.m_bindings;
 
+            resetStringBindings();
             resetPointers();
         }
 
@@ -399,14 +531,12 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
+            m_value    = std::move(other.m_value);
+            m_program  = std::move(other.m_program);
+            m_bindings = std::move(other.m_bindings);
+            other.m_bindings.clear();
 
             resetPointers();
         }
@@ -419,71 +549,154 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
+
+        if (!m_dirtyLayouts.empty())
+            m_dirtyLayouts.erase(this);
+
+        // The widget is being destroyed while updateDeferredLayouts was calling a signal handler, so it can no longer be updated
+        if (!m_widgetsPendingUpdate.empty() && m_connectedWidget)
+            m_widgetsPendingUpdate.erase(m_connectedWidget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (!m_program)
             return to_string(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
-        {
-            return "min(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if (m_operation == Operation::Maximum)
+
+        // The string is build in the same way as the program is executed, with a stack that contains the sub-expressions
+        struct SubExpression
         {
-            return "max(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
+            std::string str;
+            Operation operation;
+            float value;
+            bool hasOperands;
+            bool isPercentage;
+        };
+
+        std::vector<SubExpression> stack;
+        for (const auto& instruction : m_program->instructions)
         {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                {
+                    stack.push_back({to_string(instruction.value), Operation::Value, instruction.value, false, false});
+                    break;
+                }
+                case Operation::BindingString:
+                {
+                    const Binding& binding = m_bindings[instruction.bindingIndex];
+                    const std::string& bindingString = m_program->bindingStrings[instruction.bindingIndex];
+                    if (binding.operation == Operation::Value) // The bound widget no longer exists
+                        stack.push_back({to_string(binding.value), Operation::Value, binding.value, false, false});
+                    else if (bindingString == "&.innersize")
+                        stack.push_back({"100%", binding.operation, binding.value, false, false});
+                    else // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+                        stack.push_back({bindingString, binding.operation, binding.value, false, false});
+                    break;
+                }
+                case Operation::Minimum:
+                case Operation::Maximum:
+                {
+                    SubExpression right = std::move(stack.back());
+                    stack.pop_back();
+                    SubExpression& left = stack.back();
 
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
+                    const char* function = (instruction.operation == Operation::Minimum) ? "min(" : "max(";
+                    left = {function + left.str + ", " + right.str + ")", instruction.operation, 0, true, false};
+                    break;
+                }
+                default: // Plus, Minus, Multiplies or Divides
                 {
-                    if (!operand->m_leftOperand)
-                        return false;
+                    SubExpression right = std::move(stack.back());
+                    stack.pop_back();
+                    SubExpression& left = stack.back();
+
+                    char operatorChar;
+                    if (instruction.operation == Operation::Plus)
+                        operatorChar = '+';
+                    else if (instruction.operation == Operation::Minus)
+                        operatorChar = '-';
+                    else if (instruction.operation == Operation::Multiplies)
+                        operatorChar = '*';
+                    else // if (instruction.operation == Operation::Divides)
+                        operatorChar = '/';
+
+                    auto subExpressionNeedsBrackets = [](const SubExpression& operand)
+                        {
+                            if (!operand.hasOperands)
+                                return false;
 
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
+                            if ((operand.operation == Operation::Minimum) || (operand.operation == Operation::Maximum))
+                                return false;
 
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == "100%"))
-                        return false;
+                            if (operand.isPercentage)
+                                return false;
 
-                    return true;
-                };
+                            return true;
+                        };
 
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else
-            {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == "100%"))
-                    return to_string(m_leftOperand->getValue() * 100) + '%';
-                else
-                    return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
+                    const bool isPercentage = (instruction.operation == Operation::Multiplies) && (left.operation == Operation::Value) && (right.str == "100%");
+
+                    std::string str;
+                    if (subExpressionNeedsBrackets(left) && subExpressionNeedsBrackets(right))
+                        str = "(" + left.str + ") " + operatorChar + " (" + right.str + ")";
+                    else if (subExpressionNeedsBrackets(left))
+                        str = "(" + left.str + ") " + operatorChar + " " + right.str;
+                    else if (subExpressionNeedsBrackets(right))
+                        str = left.str + " " + operatorChar + " (" + right.str + ")";
+                    else if (isPercentage)
+                        str = to_string(left.value * 100) + '%';
+                    else
+                        str = left.str + " " + operatorChar + " " + right.str;
+
+                    left = {std::move(str), instruction.operation, 0, true, isPercentage};
+                    break;
+                }
             }
         }
-        else
+
+        assert(stack.size() == 1);
+        return stack.back().str;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::appendOperand(Program& program, const Layout& operand)
+    {
+        if (!operand.m_program)
+        {
+            program.instructions.push_back({Operation::Value, operand.m_value, 0});
+            return;
+        }
+
+        // The bindings of the operand are placed behind the ones that were already added
+        const std::size_t bindingOffset = m_bindings.size();
+        for (auto instruction : operand.m_program->instructions)
         {
-            if (m_boundString == "&.innersize")
-                return "100%";
+            if (instruction.operation == Operation::BindingString)
+                instruction.bindingIndex += bindingOffset;
 
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
+            program.instructions.push_back(instruction);
+        }
+
+        program.bindingStrings.insert(program.bindingStrings.end(), operand.m_program->bindingStrings.begin(), operand.m_program->bindingStrings.end());
+        m_bindings.insert(m_bindings.end(), operand.m_bindings.begin(), operand.m_bindings.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::resetStringBindings()
+    {
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
+        {
+            if (!m_program->bindingStrings[i].empty())
+            {
+                m_bindings[i].operation = Operation::BindingString;
+                m_bindings[i].widget = nullptr;
+            }
         }
     }
 
@@ -491,16 +704,19 @@ namespace tgui
 
     void Layout::unbindLayout()
     {
-        if (m_boundWidget)
+        for (const auto& binding : m_bindings)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            if (!binding.widget)
+                continue;
+
+            assert((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop)
+                   || (binding.operation == Operation::BindingWidth) || (binding.operation == Operation::BindingHeight)
+                   || (binding.operation == Operation::BindingInnerWidth) || (binding.operation == Operation::BindingInnerHeight));
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->unbindPositionLayout(this);
             else
-                m_boundWidget->unbindSizeLayout(this);
+                binding.widget->unbindSizeLayout(this);
         }
     }
 
@@ -508,24 +724,19 @@ namespace tgui
 
     void Layout::resetPointers()
     {
-        if (m_leftOperand != nullptr)
+        for (const auto& binding : m_bindings)
         {
-            assert(m_rightOperand != nullptr);
-
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
-        }
+            if (!binding.widget)
+                continue;
 
-        if (m_boundWidget)
-        {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            assert((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop)
+                   || (binding.operation == Operation::BindingWidth) || (binding.operation == Operation::BindingHeight)
+                   || (binding.operation == Operation::BindingInnerWidth) || (binding.operation == Operation::BindingInnerHeight));
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->bindPositionLayout(this);
             else
-                m_boundWidget->bindSizeLayout(this);
+                binding.widget->bindSizeLayout(this);
         }
     }
 
@@ -535,13 +746,44 @@ namespace tgui
     {
         const float oldValue = m_value;
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
+        if (m_program)
+        {
+            // Parse the string bindings even when the referred widget was already found. The widget may be added to a different parent.
+            // The widgets are only informed when a binding actually changed, as this function may be called while they are
+            // iterating over their bound layouts.
+            bool bindingsParsed = false;
+            std::vector<Binding> bindings = m_bindings;
+            for (std::size_t i = 0; i < bindings.size(); ++i)
+            {
+                const std::string& bindingString = m_program->bindingStrings[i];
+                if (!bindingString.empty() && parseBindingString(bindingString, widget, xAxis, bindings[i].operation, bindings[i].widget))
+                    bindingsParsed = true;
+            }
+
+            bool bindingsChanged = false;
+            for (std::size_t i = 0; i < bindings.size(); ++i)
+            {
+                if ((bindings[i].widget != m_bindings[i].widget) || (bindings[i].operation != m_bindings[i].operation))
+                {
+                    bindingsChanged = true;
+                    break;
+                }
+            }
+
+            if (bindingsChanged)
+            {
+                unbindLayout();
+                m_bindings = std::move(bindings);
+                resetPointers();
+            }
 
-        parseBindingStringRecursive(widget, xAxis);
+            // The value is left untouched when none of the referred widgets could be found
+            if (bindingsParsed)
+                calculateValue();
+        }
 
-        // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
 
         if (m_value != oldValue)
         {
@@ -552,19 +794,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::unbindWidget(Widget* widget)
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            Binding& binding = m_bindings[i];
+            if (binding.widget != widget)
+                continue;
+
+            binding.widget = nullptr;
+            if (!m_program->bindingStrings[i].empty())
+                binding.operation = Operation::BindingString;
+            else
+            {
+                binding.value = 0;
+                binding.operation = Operation::Value;
+            }
         }
 
         recalculateValue();
+
+        // A layout that only consisted of a binding to the widget becomes a constant
+        if (m_program && (m_program->instructions.size() == 1) && (m_bindings[0].operation == Operation::Value))
+        {
+            m_program = nullptr;
+            m_bindings.clear();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -573,192 +828,226 @@ namespace tgui
     {
         const float oldValue = m_value;
 
-        switch (m_operation)
+        calculateValue();
+
+        if (m_value != oldValue)
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
+            // Tell the connected widget about the new value
+            if (m_connectedWidgetCallback)
+                m_connectedWidgetCallback();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::boundWidgetChanged()
+    {
+        if (m_deferredUpdatesEnabled)
+            m_dirtyLayouts.insert(this);
+        else
+            recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::setDeferredUpdatesEnabled(bool deferred)
+    {
+        m_deferredUpdatesEnabled = deferred;
+
+        // Layouts can no longer be marked as dirty, so handle the ones that are still waiting
+        if (!deferred)
+            updateDeferredLayouts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isDeferredUpdatesEnabled()
+    {
+        return m_deferredUpdatesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::updateDeferredLayouts()
+    {
+        // When called from a signal handler while already updating, the dirty layouts will be handled by the outer call
+        if (!m_widgetsPendingUpdate.empty())
+            return;
+
+        // Changing a widget may cause other widgets to change (e.g. a layout widget updating its children),
+        // so we keep going until no more layouts were marked as dirty while updating the widgets.
+        while (!m_dirtyLayouts.empty())
+        {
+            const auto dirtyLayouts = std::move(m_dirtyLayouts);
+            m_dirtyLayouts.clear();
+
+            // Find all widgets that have to be recalculated, sorted so that widgets that depend on others come last
+            std::unordered_set<Widget*> visitedWidgets;
+            std::vector<Widget*> widgetsInReverseOrder;
+            for (Layout* layout : dirtyLayouts)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
+                if (layout->m_connectedWidget)
+                    addDependentWidgets(layout->m_connectedWidget, visitedWidgets, widgetsInReverseOrder);
+                else // The layout doesn't belong to a widget, so there is nothing to be informed about the change
+                    layout->recalculateValue();
             }
-            case Operation::BindingInnerHeight:
+
+            // Each widget only has to be updated once, as all the widgets that it depends on have already been updated.
+            // Signal handlers may destroy widgets that weren't updated yet, which removes them from the pending widgets.
+            m_widgetsPendingUpdate.insert(visitedWidgets.begin(), visitedWidgets.end());
+            for (auto it = widgetsInReverseOrder.rbegin(); it != widgetsInReverseOrder.rend(); ++it)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
+                Widget* widget = *it;
+                if (m_widgetsPendingUpdate.erase(widget) == 0)
+                    continue;
+
+                bool positionChanged = widget->m_position.x.recalculateDeferredValue();
+                positionChanged = widget->m_position.y.recalculateDeferredValue() || positionChanged;
+                if (positionChanged)
+                    widget->setPosition(widget->getPositionLayout());
+
+                bool sizeChanged = widget->m_size.x.recalculateDeferredValue();
+                sizeChanged = widget->m_size.y.recalculateDeferredValue() || sizeChanged;
+                if (sizeChanged)
+                    widget->setSize(widget->getSizeLayout());
             }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
+        }
+    }
 
-        if (m_value != oldValue)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::addDependentWidgets(Widget* widget, std::unordered_set<Widget*>& visitedWidgets, std::vector<Widget*>& widgetsInReverseOrder)
+    {
+        if (!visitedWidgets.insert(widget).second)
+            return;
+
+        for (const auto* boundLayouts : {&widget->m_boundPositionLayouts, &widget->m_boundSizeLayouts})
         {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
+            for (const Layout* layout : *boundLayouts)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                if (layout->m_connectedWidget)
+                    addDependentWidgets(layout->m_connectedWidget, visitedWidgets, widgetsInReverseOrder);
             }
         }
+
+        widgetsInReverseOrder.push_back(widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    bool Layout::recalculateDeferredValue()
     {
-        if (m_leftOperand)
-        {
-            assert(m_rightOperand != nullptr);
+        if (!m_dirtyLayouts.empty())
+            m_dirtyLayouts.erase(this);
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
-        }
-
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+        const float oldValue = m_value;
+        calculateValue();
+        return m_value != oldValue;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    void Layout::calculateValue()
     {
-        if (expression == "x" || expression == "left")
-        {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
-        }
-        else if (expression == "y" || expression == "top")
-        {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
-        }
-        else if (expression == "w" || expression == "width")
-        {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
-        }
-        else if (expression == "h" || expression == "height")
-        {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
-        }
-        else if (expression == "iw" || expression == "innerwidth")
-        {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
-        }
-        else if (expression == "ih" || expression == "innerheight")
-        {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
-        }
-        else if (expression == "size")
-        {
-            if (xAxis)
-                return parseBindingString("width", widget, xAxis);
-            else
-                return parseBindingString("height", widget, xAxis);
-        }
-        else if (expression == "innersize")
-        {
-            if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
-            else
-                return parseBindingString("innerheight", widget, xAxis);
-        }
-        else if ((expression == "pos") || (expression == "position"))
-        {
-            if (xAxis)
-                return parseBindingString("x", widget, xAxis);
-            else
-                return parseBindingString("y", widget, xAxis);
-        }
-        else
+        if (!m_program)
+            return;
+
+        for (auto& binding : m_bindings)
         {
-            const auto dotPos = expression.find('.');
-            if (dotPos != std::string::npos)
+            if (!binding.widget)
+                continue;
+
+            switch (binding.operation)
             {
-                const std::string widgetName = expression.substr(0, dotPos);
-                if (widgetName == "parent" || widgetName == "&")
+                case Operation::BindingLeft:
+                    binding.value = binding.widget->getPosition().x;
+                    break;
+                case Operation::BindingTop:
+                    binding.value = binding.widget->getPosition().y;
+                    break;
+                case Operation::BindingWidth:
+                    binding.value = binding.widget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    binding.value = binding.widget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth:
                 {
-                    if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                    const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                    if (boundContainer)
+                        binding.value = boundContainer->getInnerSize().x;
+                    break;
                 }
-                else if (!widgetName.empty())
+                case Operation::BindingInnerHeight:
                 {
-                    // If the widget is a container, search in its children first
-                    Container* container = dynamic_cast<Container*>(widget);
-                    if (container != nullptr)
-                    {
-                        const auto& widgets = container->getWidgets();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
-
-                    // If the widget has a parent, look for a sibling
-                    if (widget->getParent())
-                    {
-                        const auto& widgets = widget->getParent()->getWidgets();
-                        for (std::size_t i = 0; i < widgets.size(); ++i)
-                        {
-                            if (toLower(widgets[i]->getWidgetName()) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
-                        }
-                    }
+                    const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                    if (boundContainer)
+                        binding.value = boundContainer->getInnerSize().y;
+                    break;
                 }
+                default: // Only bindings to widgets are possible when a widget is set
+                    assert(false);
+                    break;
             }
+        }
 
-            // The referred widget was not found or there was something wrong with the string
-            return;
+        // Most programs are small enough to be executed without allocating memory for the stack
+        float fixedStack[16];
+        std::vector<float> dynamicStack;
+        float* stack = fixedStack;
+        if (m_program->stackSize > sizeof(fixedStack) / sizeof(fixedStack[0]))
+        {
+            dynamicStack.resize(m_program->stackSize);
+            stack = dynamicStack.data();
         }
 
-        resetPointers();
-        recalculateValue();
+        std::size_t stackSize = 0;
+        for (const auto& instruction : m_program->instructions)
+        {
+            switch (instruction.operation)
+            {
+                case Operation::Value:
+                    stack[stackSize++] = instruction.value;
+                    break;
+                case Operation::BindingString:
+                    // When the binding string wasn't parsed yet or the widget was destroyed then the last known value is used
+                    stack[stackSize++] = m_bindings[instruction.bindingIndex].value;
+                    break;
+                case Operation::Plus:
+                    --stackSize;
+                    stack[stackSize-1] = stack[stackSize-1] + stack[stackSize];
+                    break;
+                case Operation::Minus:
+                    --stackSize;
+                    stack[stackSize-1] = stack[stackSize-1] - stack[stackSize];
+                    break;
+                case Operation::Multiplies:
+                    --stackSize;
+                    stack[stackSize-1] = stack[stackSize-1] * stack[stackSize];
+                    break;
+                case Operation::Divides:
+                    --stackSize;
+                    if (stack[stackSize] != 0)
+                        stack[stackSize-1] = stack[stackSize-1] / stack[stackSize];
+                    else
+                        stack[stackSize-1] = 0;
+                    break;
+                case Operation::Minimum:
+                    --stackSize;
+                    stack[stackSize-1] = std::min(stack[stackSize-1], stack[stackSize]);
+                    break;
+                case Operation::Maximum:
+                    --stackSize;
+                    stack[stackSize-1] = std::max(stack[stackSize-1], stack[stackSize]);
+                    break;
+                default: // The programs never contain bindings to widgets directly, they load the value from m_bindings
+                    assert(false);
+                    break;
+            }
+        }
+
+        assert(stackSize == 1);
+        m_value = stack[0];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,42 +28,41 @@
 #include <TGUI/String.hpp>
 #include <TGUI/to_string.hpp>
 
-#include <cctype>
+#include <unordered_map>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
+        while ((input.pos != input.end) && isWhitespace(*input.pos)) \
+            ++input.pos; \
+        \
+        if (input.peek() == EOF) \
             break; \
         \
-        if (stream.peek() == '/') \
+        if (input.peek() == '/') \
         { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
+            ++input.pos; \
+            if (input.peek() == '/') \
             { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
+                skipLine(input); \
             } \
-            else if (stream.peek() == '*') \
+            else if (input.peek() == '*') \
             { \
-                while (stream.peek() != EOF) \
+                while (input.peek() != EOF) \
                 { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
+                    ++input.pos; \
+                    if (input.peek() == '*') \
                     { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
+                        ++input.pos; \
+                        if (input.peek() == '/') \
                         { \
-                            stream.read(&c, 1); \
+                            ++input.pos; \
                             break; \
                         } \
                     } \
@@ -78,7 +77,7 @@
         break; \
     } \
     \
-    if (stream.peek() == EOF) \
+    if (input.peek() == EOF) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -92,70 +91,125 @@ namespace tgui
 {
     namespace
     {
+        // Read position inside the contiguous buffer that is being parsed.
+        // Tokens are copied straight from the buffer into the nodes, without going through a stream.
+        struct InputBuffer
+        {
+            const char* const begin;
+            const char* pos;
+            const char* const end;
+
+            int peek() const
+            {
+                return (pos != end) ? static_cast<unsigned char>(*pos) : EOF;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Same characters as std::isspace in the "C" locale
+        bool isWhitespace(char c)
+        {
+            return (c == ' ') || (c == '\n') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Characters that can be copied into a word without further inspection
+        bool isPlainWordCharacter(char c)
+        {
+            return !isWhitespace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}') && (c != '/') && (c != '"');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Moves the read position behind the next newline character, or to the end of the input if there is none
+        void skipLine(InputBuffer& input)
+        {
+            const void* newline = std::memchr(input.pos, '\n', static_cast<std::size_t>(input.end - input.pos));
+            if (newline)
+                input.pos = static_cast<const char*>(newline) + 1;
+            else
+                input.pos = input.end;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Copies a quoted string (of which the opening quote was already copied) to the output
+        void readQuotedString(InputBuffer& input, std::string& output)
+        {
+            bool backslash = false;
+            while (input.pos != input.end)
+            {
+                const char c = *input.pos++;
+                output.push_back(c);
+
+                if (c == '"' && !backslash)
+                    break;
+
+                if (c == '\\' && !backslash)
+                    backslash = true;
+                else
+                    backslash = false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, std::string sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(InputBuffer& input)
         {
-            std::string word = "";
-            while (stream.peek() != EOF)
+            std::string word;
+            while (input.pos != input.end)
             {
-                char c = static_cast<char>(stream.peek());
+                // Copy all normal characters at once
+                const char* const wordPartStart = input.pos;
+                while ((input.pos != input.end) && isPlainWordCharacter(*input.pos) && (*input.pos != '\r'))
+                    ++input.pos;
+
+                word.append(wordPartStart, input.pos);
+                if (input.pos == input.end)
+                    break;
+
+                char c = *input.pos;
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     return word;
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                else if (!isWhitespace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peek() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        skipLine(input);
+                        if (input.pos[-1] == '\n')
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                assert(!word.empty()); // No known case in which you can pass here with an empty word
-                                return word;
-                            }
+                            assert(!word.empty()); // No known case in which you can pass here with an empty word
+                            return word;
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peek() == '*'))
                     {
-                        while (stream.peek() != EOF)
+                        while (input.pos != input.end)
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            c = *input.pos++;
+                            if ((c == '*') && (input.peek() == '/'))
                             {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
+                                ++input.pos;
+                                break;
                             }
                         }
                     }
                     else if (c == '"')
                     {
                         word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
+                        readQuotedString(input, word);
                     }
                     else
                         word.push_back(c);
@@ -169,37 +223,32 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        std::string readLine(InputBuffer& input)
         {
             std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (input.pos != input.end)
             {
-                char c = static_cast<char>(stream.peek());
+                char c = *input.pos;
 
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    ++input.pos;
+                    if (input.peek() == '/')
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
+                        skipLine(input);
                     }
-                    else if (stream.peek() == '*')
+                    else if (input.peek() == '*')
                     {
-                        while (stream.peek() != EOF)
+                        while (input.peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
+                            ++input.pos;
+                            if (input.peek() == '*')
                             {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
+                                ++input.pos;
+                                if (input.peek() == '/')
                                 {
-                                    stream.read(&c, 1);
+                                    ++input.pos;
                                     break;
                                 }
                             }
@@ -217,28 +266,14 @@ namespace tgui
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     line.push_back(c);
+                    readQuotedString(input, line);
 
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
-
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
+                    if (input.pos == input.end)
                         return "";
 
-                    c = static_cast<char>(stream.peek());
+                    c = *input.pos;
                 }
 
                 if ((c == '=') || (c == '{'))
@@ -249,9 +284,9 @@ namespace tgui
                     line.erase(line.find_last_not_of(" \n\r\t")+1);
                     return line;
                 }
-                else if (::isspace(c))
+                else if (isWhitespace(c))
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -260,9 +295,17 @@ namespace tgui
                 }
                 else
                 {
+                    // Copy all normal characters at once
+                    const char* const linePartStart = input.pos;
+                    while ((input.pos != input.end) && isPlainWordCharacter(*input.pos))
+                        ++input.pos;
+
+                    // A slash or quote directly behind a quoted string is copied as a normal character
+                    if (input.pos == linePartStart)
+                        ++input.pos;
+
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    line.append(linePartStart, input.pos);
                 }
             }
 
@@ -271,92 +314,99 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        // Fills the value list when the value is a list (e.g. "[1, 2, 3]")
+        void splitListValue(DataIO::ValueNode& valueNode, const std::string& line)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
-
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
-
-            // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
-
-            // Read the value
-            std::string line = trim(readLine(stream));
-            if (!line.empty())
+            if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
             {
-                // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
-
-                // Create a value node to store the value
-                auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
-
-                // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                valueNode.listNode = true;
+                if (line.size() >= 3)
                 {
-                    valueNode->listNode = true;
-                    if (line.size() >= 3)
-                    {
-                        valueNode->valueList.push_back("");
+                    valueNode.valueList.push_back("");
 
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
+                    std::size_t i = 1;
+                    while (i < line.size()-1)
+                    {
+                        if (line[i] == ',')
                         {
-                            if (line[i] == ',')
-                            {
-                                i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
-                            }
-                            else if (line[i] == '"')
+                            i++;
+                            valueNode.valueList.back() = trim(valueNode.valueList.back());
+                            valueNode.valueList.push_back("");
+                        }
+                        else if (line[i] == '"')
+                        {
+                            valueNode.valueList.back().push_back(line[i]);
+                            i++;
+
+                            bool backslash = false;
+                            while (i < line.size()-1)
                             {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-                                i++;
+                                valueNode.valueList.back().push_back(line[i]);
 
-                                bool backslash = false;
-                                while (i < line.size()-1)
+                                if (line[i] == '"' && !backslash)
                                 {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
-
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
                                     i++;
+                                    break;
                                 }
-                            }
-                            else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().size(), 1, line[i]);
+
+                                if (line[i] == '\\' && !backslash)
+                                    backslash = true;
+                                else
+                                    backslash = false;
+
                                 i++;
                             }
                         }
-
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
+                        else
+                        {
+                            valueNode.valueList.back().push_back(line[i]);
+                            i++;
+                        }
                     }
+
+                    valueNode.valueList.back() = trim(valueNode.valueList.back());
                 }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseKeyValue(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        {
+            // Skip the assignment symbol and remove the whitespace behind it
+            ++input.pos;
+
+            REMOVE_WHITESPACE_AND_COMMENTS(true)
+
+            // Check for subsection as value
+            if (input.peek() == '{')
+                return parseSection(input, node, key);
+
+            // Read the value
+            std::string line = trim(readLine(input));
+            if (!line.empty())
+            {
+                // Remove the ';' if it is there
+                if (input.peek() == ';')
+                    ++input.pos;
+
+                // Create a value node to store the value
+                auto valueNode = std::make_unique<DataIO::ValueNode>();
+
+                // It might be a list node
+                splitListValue(*valueNode, line);
 
+                valueNode->value = std::move(line);
                 node->propertyValuePairs[toLower(key)] = std::move(valueNode);
                 return "";
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.peek() == EOF)
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
+                    const char chr = *input.pos;
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -369,59 +419,58 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& node, std::string sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            sectionNode->name = std::move(sectionName);
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the brace
+            ++input.pos;
 
-            while (stream.peek() != EOF)
+            while (input.peek() != EOF)
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                std::string word = readWord(stream);
-                if (word == "")
+                std::string word = readWord(input);
+                if (word.empty())
                 {
-                    if (stream.peek() == EOF)
+                    if (input.peek() == EOF)
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        ++input.pos;
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            ++input.pos;
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + std::string(1, *input.pos) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    std::string error = parseSection(input, sectionNode, std::move(word));
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    std::string error = parseKeyValue(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, *input.pos) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -429,25 +478,271 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(InputBuffer& input, const std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            std::string word = readWord(stream);
-            if (word == "")
+            std::string word = readWord(input);
+            if (word.empty())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + std::string(1, *input.pos) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, std::move(word));
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, word);
             else
-                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{' or '=', found '" + std::string(1, *input.pos) + "' instead.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Compiled widget files start with this signature, followed by the version of the format
+        const char binarySignature[8] = {'\x89', 'T', 'G', 'U', 'I', 'F', 'R', 'M'};
+        const std::uint32_t binaryFormatVersion = 1;
+
+        // Compiled input with nodes nested deeper than this is rejected, as reading each level takes stack space
+        const unsigned int binaryMaxNestingDepth = 256;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeUint32(std::string& output, std::uint32_t value)
+        {
+            output.push_back(static_cast<char>(value & 0xFF));
+            output.push_back(static_cast<char>((value >> 8) & 0xFF));
+            output.push_back(static_cast<char>((value >> 16) & 0xFF));
+            output.push_back(static_cast<char>((value >> 24) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes the tree in the compiled format. All strings are stored once in a table in front of the tree, the tree itself
+        // only consists of indices into that table.
+        class BinaryWriter
+        {
+        public:
+
+            void writeRootNode(const DataIO::Node& root)
+            {
+                // Just like in the text format, the name of the root node is not saved
+                writeUint32(m_tree, getStringIndex(""));
+                writeNodeContents(root);
+            }
+
+            void writeTo(std::stringstream& stream) const
+            {
+                std::string header(binarySignature, sizeof(binarySignature));
+                writeUint32(header, binaryFormatVersion);
+                writeUint32(header, static_cast<std::uint32_t>(m_strings.size()));
+                for (const auto& str : m_strings)
+                {
+                    writeUint32(header, static_cast<std::uint32_t>(str.size()));
+                    header += str;
+                }
+
+                stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+                stream.write(m_tree.data(), static_cast<std::streamsize>(m_tree.size()));
+            }
+
+        private:
+
+            void writeNodeContents(const DataIO::Node& node)
+            {
+                writeUint32(m_tree, static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+                for (const auto& pair : node.propertyValuePairs)
+                {
+                    // Store the key and list items the way the text parser would have produced them
+                    DataIO::ValueNode valueNode;
+                    splitListValue(valueNode, pair.second->value);
+
+                    writeUint32(m_tree, getStringIndex(toLower(pair.first)));
+                    writeUint32(m_tree, getStringIndex(pair.second->value));
+                    m_tree.push_back(valueNode.listNode ? 1 : 0);
+                    if (valueNode.listNode)
+                    {
+                        writeUint32(m_tree, static_cast<std::uint32_t>(valueNode.valueList.size()));
+                        for (const auto& item : valueNode.valueList)
+                            writeUint32(m_tree, getStringIndex(item));
+                    }
+                }
+
+                writeUint32(m_tree, static_cast<std::uint32_t>(node.children.size()));
+                for (const auto& child : node.children)
+                {
+                    writeUint32(m_tree, getStringIndex(child->name));
+                    writeNodeContents(*child);
+                }
+            }
+
+            std::uint32_t getStringIndex(const std::string& str)
+            {
+                const auto it = m_stringIndices.find(str);
+                if (it != m_stringIndices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(m_strings.size());
+                m_stringIndices[str] = index;
+                m_strings.push_back(str);
+                return index;
+            }
+
+        private:
+
+            std::string m_tree;
+            std::vector<std::string> m_strings;
+            std::unordered_map<std::string, std::uint32_t> m_stringIndices;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the tree from the compiled format. The strings are copied directly from the input into the nodes.
+        class BinaryReader
+        {
+        public:
+
+            BinaryReader(const char* data, const char* end) :
+                m_pos{data},
+                m_end{end}
+            {
+            }
+
+            std::unique_ptr<DataIO::Node> readTree()
+            {
+                m_pos += sizeof(binarySignature);
+                if (readUint32() != binaryFormatVersion)
+                    throw Exception{"Error while parsing compiled input. Unsupported version of the compiled format."};
+
+                const std::uint32_t stringCount = readUint32();
+                if (stringCount > static_cast<std::size_t>(m_end - m_pos) / 4)
+                    throw Exception{"Error while parsing compiled input. Unexpected end of data."};
+
+                m_strings.reserve(stringCount);
+                for (std::uint32_t i = 0; i < stringCount; ++i)
+                {
+                    const std::uint32_t length = readUint32();
+                    if (length > static_cast<std::size_t>(m_end - m_pos))
+                        throw Exception{"Error while parsing compiled input. Unexpected end of data."};
+
+                    m_strings.emplace_back(m_pos, length);
+                    m_pos += length;
+                }
+
+                auto root = std::make_unique<DataIO::Node>();
+                readNode(*root, 0);
+
+                if (m_pos != m_end)
+                    throw Exception{"Error while parsing compiled input. Unexpected data found behind the tree of nodes."};
+
+                return root;
+            }
+
+        private:
+
+            void readNode(DataIO::Node& node, unsigned int depth)
+            {
+                if (depth > binaryMaxNestingDepth)
+                    throw Exception{"Error while parsing compiled input. Nodes are nested more than " + to_string(binaryMaxNestingDepth) + " levels deep."};
+
+                node.name = readString();
+
+                const std::uint32_t propertyCount = readUint32();
+                for (std::uint32_t i = 0; i < propertyCount; ++i)
+                {
+                    std::string key = readString();
+
+                    auto valueNode = std::make_unique<DataIO::ValueNode>(readString());
+                    valueNode->listNode = (readByte() != 0);
+                    if (valueNode->listNode)
+                    {
+                        const std::uint32_t itemCount = readUint32();
+                        for (std::uint32_t j = 0; j < itemCount; ++j)
+                            valueNode->valueList.push_back(readString());
+                    }
+
+                    node.propertyValuePairs[std::move(key)] = std::move(valueNode);
+                }
+
+                const std::uint32_t childCount = readUint32();
+                for (std::uint32_t i = 0; i < childCount; ++i)
+                {
+                    auto child = std::make_unique<DataIO::Node>();
+                    child->parent = &node;
+                    readNode(*child, depth + 1);
+                    node.children.push_back(std::move(child));
+                }
+            }
+
+            std::string readString()
+            {
+                const std::uint32_t index = readUint32();
+                if (index >= m_strings.size())
+                    throw Exception{"Error while parsing compiled input. Invalid string index found."};
+
+                return std::string{m_strings[index].first, m_strings[index].second};
+            }
+
+            std::uint32_t readUint32()
+            {
+                if (m_end - m_pos < 4)
+                    throw Exception{"Error while parsing compiled input. Unexpected end of data."};
+
+                const auto* bytes = reinterpret_cast<const unsigned char*>(m_pos);
+                m_pos += 4;
+                return static_cast<std::uint32_t>(bytes[0])
+                     | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                     | (static_cast<std::uint32_t>(bytes[2]) << 16)
+                     | (static_cast<std::uint32_t>(bytes[3]) << 24);
+            }
+
+            unsigned char readByte()
+            {
+                if (m_pos == m_end)
+                    throw Exception{"Error while parsing compiled input. Unexpected end of data."};
+
+                return static_cast<unsigned char>(*m_pos++);
+            }
+
+        private:
+
+            const char* m_pos;
+            const char* const m_end;
+            std::vector<std::pair<const char*, std::uint32_t>> m_strings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> parseBuffer(InputBuffer& input)
+        {
+            // Compiled files are recognized by their signature
+            if ((static_cast<std::size_t>(input.end - input.pos) >= sizeof(binarySignature))
+             && (std::memcmp(input.pos, binarySignature, sizeof(binarySignature)) == 0))
+            {
+                return BinaryReader{input.pos, input.end}.readTree();
+            }
+
+            auto root = std::make_unique<DataIO::Node>();
+
+            while (input.pos != input.end)
+            {
+                const std::string error = parseRootSection(input, root);
+                if (!error.empty())
+                {
+                    const std::size_t lineNumber = std::count(input.begin, input.pos, '\n') + 1;
+
+                    const char* lineStart = input.pos;
+                    while ((lineStart != input.begin) && (lineStart[-1] != '\n'))
+                        --lineStart;
+
+                    const std::size_t columnNumber = static_cast<std::size_t>(input.pos - lineStart) + 1;
+                    throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ", column " + to_string(columnNumber) + ". " + error};
+                }
+            }
+
+            return root;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -497,27 +792,25 @@ namespace tgui
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
-        auto root = std::make_unique<Node>();
+        if (stream.peek() == EOF)
+            return std::make_unique<Node>();
 
-        std::string error;
-        while (stream.peek() != EOF)
-        {
-            error = parseRootSection(stream, root);
-            if (!error.empty())
-            {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
-                    throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
-            }
-        }
+        // Parse the remaining part of the stream, but keep the whole string so that the line numbers in errors are correct
+        const std::string str = stream.str();
+        const auto position = static_cast<std::size_t>(stream.tellg());
+        stream.seekg(0, std::ios_base::end);
+        stream.peek(); // Set the eof flag, like when the stream would have been read character by character
+
+        InputBuffer input{str.data(), str.data() + position, str.data() + str.size()};
+        return parseBuffer(input);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return root;
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
+    {
+        InputBuffer input{data, data, data + size};
+        return parseBuffer(input);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,6 +838,15 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    {
+        BinaryWriter writer;
+        writer.writeRootNode(*rootNode);
+        writer.writeTo(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,14 +176,21 @@ namespace tgui
 
             std::string result = "\"" + texture.getId() + "\"";
 
-            if ((texture.getData()->rect != sf::IntRect{}) && texture.getData()->image
-             && (texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(texture.getData()->image->getSize().x), static_cast<int>(texture.getData()->image->getSize().y)}))
+            // The image might not have been kept in memory, in which case the part is written even if it covers the entire image
+            sf::Vector2u imageSize;
+            if (texture.getData()->image)
+                imageSize = texture.getData()->image->getSize();
+            else if (texture.getData()->alphaMask)
+                imageSize = texture.getData()->alphaMask->size;
+
+            if ((texture.getData()->rect != sf::IntRect{}) && !texture.getData()->svgImage
+             && (texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)}))
             {
                 result += " Part(" + to_string(texture.getData()->rect.left) + ", " + to_string(texture.getData()->rect.top)
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getImageSize().x), static_cast<int>(texture.getImageSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -311,6 +311,7 @@ namespace tgui
             renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
             for (const auto& property : properties)
                 renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            renderer->invalidatePropertySlots();
 
             // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
             auto oldIt = oldData->propertyValuePairs.begin();
@@ -100,9 +100,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::pair<std::string, const RendererData*>, WidgetFactory::Prototype> WidgetFactory::m_prototypes;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetFactory::setConstructFunction(const std::string& type, const std::function<Widget::Ptr()>& constructor)
     {
-        m_constructFunctions[toLower(type)] = constructor;
+        const std::string lowercaseType = toLower(type);
+        m_constructFunctions[lowercaseType] = constructor;
+
+        // Prototypes made with the old construct function may no longer be correct
+        for (auto it = m_prototypes.begin(); it != m_prototypes.end();)
+        {
+            if (it->first.first == lowercaseType)
+                it = m_prototypes.erase(it);
+            else
+                ++it;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,6 +127,47 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr WidgetFactory::createFromPrototype(const std::string& type, std::shared_ptr<RendererData> rendererData)
+    {
+        const std::string lowercaseType = toLower(type);
+        const Theme* defaultTheme = Theme::getDefault();
+        const Font globalFont = getGlobalFont();
+        const unsigned int globalTextSize = getGlobalTextSize();
+
+        auto it = m_prototypes.find({lowercaseType, rendererData.get()});
+        if ((it != m_prototypes.end())
+         && ((it->second.defaultTheme != defaultTheme) || (it->second.globalFont != globalFont) || (it->second.globalTextSize != globalTextSize)))
+        {
+            m_prototypes.erase(it);
+            it = m_prototypes.end();
+        }
+
+        if (it == m_prototypes.end())
+        {
+            const auto constructorIt = m_constructFunctions.find(lowercaseType);
+            if ((constructorIt == m_constructFunctions.end()) || !constructorIt->second)
+                return nullptr;
+
+            Widget::Ptr widget = constructorIt->second();
+            if (rendererData)
+                widget->setRenderer(rendererData);
+
+            // The prototype keeps the renderer data alive, so its address can't be reused by other data while it is a key
+            it = m_prototypes.insert({{lowercaseType, rendererData.get()}, {widget, defaultTheme, globalFont, globalTextSize}}).first;
+        }
+
+        return it->second.widget->clone();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetFactory::clearPrototypes()
+    {
+        m_prototypes.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RenderBatch.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    RenderBatch* RenderBatch::m_activeBatch = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::begin(sf::RenderTarget& target, bool batching)
+    {
+        m_target = &target;
+        m_batchingEnabled = batching;
+        m_drawCallCount = 0;
+        m_vertices.clear();
+
+        m_previousBatch = m_activeBatch;
+        m_activeBatch = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::end()
+    {
+        flushVertices();
+
+        m_activeBatch = m_previousBatch;
+        m_previousBatch = nullptr;
+        m_target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int RenderBatch::getDrawCallCount() const
+    {
+        return m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                                   sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        RenderBatch* batch = m_activeBatch;
+        if (!batch || (batch->m_target != &target))
+        {
+            target.draw(vertices, vertexCount, type, states);
+            return;
+        }
+
+        // Only triangles without a shader can be merged, other primitives are drawn immediately
+        if (!batch->m_batchingEnabled || states.shader
+         || ((type != sf::PrimitiveType::Triangles) && (type != sf::PrimitiveType::TrianglesStrip) && (type != sf::PrimitiveType::TrianglesFan)))
+        {
+            batch->flushVertices();
+            target.draw(vertices, vertexCount, type, states);
+            batch->m_drawCallCount++;
+            return;
+        }
+
+        if (vertexCount < 3)
+            return;
+
+        if (!batch->m_vertices.empty() && ((batch->m_texture != states.texture) || !(batch->m_blendMode == states.blendMode)))
+            batch->flushVertices();
+
+        batch->m_texture = states.texture;
+        batch->m_blendMode = states.blendMode;
+
+        // The transformation is applied here as the merged vertices are drawn without a transform
+        const auto addVertex = [&](std::size_t index){
+            batch->m_vertices.emplace_back(states.transform.transformPoint(vertices[index].position), vertices[index].color, vertices[index].texCoords);
+        };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            batch->m_vertices.reserve(batch->m_vertices.size() + vertexCount);
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+            {
+                addVertex(i);
+                addVertex(i+1);
+                addVertex(i+2);
+            }
+        }
+        else // Strips and fans have to be split in separate triangles
+        {
+            batch->m_vertices.reserve(batch->m_vertices.size() + 3 * (vertexCount - 2));
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                addVertex((type == sf::PrimitiveType::TrianglesStrip) ? i-2 : 0);
+                addVertex(i-1);
+                addVertex(i);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::drawDrawable(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        RenderBatch* batch = m_activeBatch;
+        if (batch && (batch->m_target == &target))
+        {
+            batch->flushVertices();
+            batch->m_drawCallCount++;
+        }
+
+        target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flush()
+    {
+        if (m_activeBatch)
+            m_activeBatch->flushVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flushVertices()
+    {
+        if (m_vertices.empty())
+            return;
+
+        sf::RenderStates states;
+        states.texture = m_texture;
+        states.blendMode = m_blendMode;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        if (sf::VertexBuffer::isAvailable())
+        {
+            if (!m_vertexBuffer)
+                m_vertexBuffer = std::make_unique<sf::VertexBuffer>(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Stream);
+
+            // Grow the buffer in large steps to avoid reallocating it every frame
+            if (m_vertexBuffer->getVertexCount() < m_vertices.size())
+                m_vertexBuffer->create(m_vertices.size() * 2);
+
+            m_vertexBuffer->update(m_vertices.data(), m_vertices.size(), 0);
+            m_target->draw(*m_vertexBuffer, 0, m_vertices.size(), states);
+        }
+        else
+    #endif
+            m_target->draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+
+        m_drawCallCount++;
+        m_vertices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
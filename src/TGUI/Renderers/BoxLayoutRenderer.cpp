@@ -34,22 +34,26 @@ namespace tgui
 
     void BoxLayoutRenderer::setSpaceBetweenWidgets(float distance)
     {
-        setProperty("spacebetweenwidgets", ObjectConverter{distance});
+        static const RendererPropertyId id = getRendererPropertyId("spacebetweenwidgets");
+        setProperty(id, ObjectConverter{distance});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float BoxLayoutRenderer::getSpaceBetweenWidgets() const
     {
-        auto it = m_data->propertyValuePairs.find("spacebetweenwidgets");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        static const RendererPropertyId spaceBetweenWidgetsId = getRendererPropertyId("spacebetweenwidgets");
+        static const RendererPropertyId paddingId = getRendererPropertyId("padding");
+
+        ObjectConverter* value = m_data->findProperty(spaceBetweenWidgetsId);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("padding");
-            if (it != m_data->propertyValuePairs.end())
+            value = m_data->findProperty(paddingId);
+            if (value)
             {
-                const Padding padding = it->second.getOutline();
+                const Padding padding = value->getOutline();
                 return std::max(std::min(padding.getLeft(), padding.getRight()), std::min(padding.getTop(), padding.getBottom()));
             }
             else
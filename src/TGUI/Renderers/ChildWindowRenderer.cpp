@@ -56,14 +56,17 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("titlebarheight");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        static const RendererPropertyId titleBarHeightId = getRendererPropertyId("titlebarheight");
+        static const RendererPropertyId textureTitleBarId = getRendererPropertyId("texturetitlebar");
+
+        ObjectConverter* value = m_data->findProperty(titleBarHeightId);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("texturetitlebar");
-            if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
-                return it->second.getTexture().getImageSize().y;
+            value = m_data->findProperty(textureTitleBarId);
+            if (value && value->getTexture().getData())
+                return value->getTexture().getImageSize().y;
             else
                 return 20;
         }
@@ -73,7 +76,8 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("titlebarheight", ObjectConverter{number});
+        static const RendererPropertyId id = getRendererPropertyId("titlebarheight");
+        setProperty(id, ObjectConverter{number});
     }
 }
 
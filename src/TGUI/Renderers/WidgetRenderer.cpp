@@ -26,10 +26,137 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 
+#include <unordered_map>
+#include <mutex>
+#include <cassert>
+#include <deque>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct RendererPropertyRegistry
+        {
+            std::mutex mutex; // Ids may be requested while initializing function-local statics on any thread
+            std::unordered_map<std::string, RendererPropertyId> ids;
+            std::deque<std::string> names; // Deque doesn't invalidate references to the names when adding new ones
+        };
+
+        RendererPropertyRegistry& getRendererPropertyRegistry()
+        {
+            static RendererPropertyRegistry registry;
+            return registry;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyId getRendererPropertyId(const std::string& property)
+    {
+        auto& registry = getRendererPropertyRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        const auto it = registry.ids.find(property);
+        if (it != registry.ids.end())
+            return it->second;
+
+        const RendererPropertyId id = registry.names.size();
+        registry.names.push_back(property);
+        registry.ids[property] = id;
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& getRendererPropertyName(RendererPropertyId id)
+    {
+        auto& registry = getRendererPropertyRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        assert(id < registry.names.size());
+        return registry.names[id];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererData::RendererData(const RendererData& other) :
+        propertyValuePairs{other.propertyValuePairs},
+        observers         {other.observers},
+        shared            {other.shared}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererData& RendererData::operator=(const RendererData& other)
+    {
+        if (this != &other)
+        {
+            propertyValuePairs = other.propertyValuePairs;
+            observers = other.observers;
+            shared = other.shared;
+            invalidatePropertySlots();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererData::findProperty(RendererPropertyId id)
+    {
+        // Rebuild the slots when properties were added or removed since they were last updated
+        if (!m_slotsValid || (m_slotsPropertyCount != propertyValuePairs.size()))
+        {
+            m_slots.clear();
+            for (auto& pair : propertyValuePairs)
+            {
+                const RendererPropertyId slot = getRendererPropertyId(pair.first);
+                if (slot >= m_slots.size())
+                    m_slots.resize(slot + 1, nullptr);
+
+                m_slots[slot] = &pair.second;
+            }
+
+            m_slotsPropertyCount = propertyValuePairs.size();
+            m_slotsValid = true;
+        }
+
+        if (id < m_slots.size())
+            return m_slots[id];
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererData::getOrAddProperty(RendererPropertyId id)
+    {
+        ObjectConverter* value = findProperty(id);
+        if (value)
+            return *value;
+
+        // The slots were up-to-date before the property was added, so we can just add the new property to them
+        value = &propertyValuePairs[getRendererPropertyName(id)];
+        if (id >= m_slots.size())
+            m_slots.resize(id + 1, nullptr);
+
+        m_slots[id] = value;
+        m_slotsPropertyCount = propertyValuePairs.size();
+        return *value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::invalidatePropertySlots()
+    {
+        m_slotsValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +165,8 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        static const RendererPropertyId id = getRendererPropertyId("opacity");
+        setProperty(id, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,26 +175,29 @@ namespace tgui
 
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
+        static const RendererPropertyId id = getRendererPropertyId("opacitydisabled");
         if (opacity != -1.f)
-            setProperty("opacitydisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(id, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("opacitydisabled", ObjectConverter{-1.f});
+            setProperty(id, ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        static const RendererPropertyId id = getRendererPropertyId("font");
+        setProperty(id, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        static const RendererPropertyId id = getRendererPropertyId("font");
+        ObjectConverter* value = m_data->findProperty(id);
+        if (value)
+            return value->getFont();
         else
             return {};
     }
@@ -75,14 +206,21 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(getRendererPropertyId(toLower(property)), std::move(value));
+    }
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(RendererPropertyId id, ObjectConverter&& value)
+    {
+        ObjectConverter& oldValue = m_data->getOrAddProperty(id);
+        if (oldValue != value)
         {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+            oldValue = value;
 
+            const std::string& property = getRendererPropertyName(id);
             for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+                observer.second(property);
         }
     }
 
@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
 #include <set>
 
 #undef MessageBox  // windows.h defines MessageBox when NOMB isn't defined before including windows.h
@@ -128,9 +129,10 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Signal::Signal(const Signal& other) :
-        m_enabled {other.m_enabled},
-        m_name    {other.m_name},
-        m_handlers{} // signal handlers are not copied with the widget
+        m_enabled       {other.m_enabled},
+        m_name          {other.m_name},
+        m_parameterCount{other.m_parameterCount},
+        m_handlers      {} // signal handlers are not copied with the widget
     {
     }
 
@@ -142,7 +144,8 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_parameterCount = other.m_parameterCount;
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -152,32 +155,59 @@ namespace tgui
 
     unsigned int Signal::connect(const Delegate& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = handler;
-        return id;
+        return addHandler(handler);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::connect(const DelegateEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id);
+        if (!m_handlers)
+            return false;
+
+        const auto isHandler = [id](const Handler& handler){ return handler.id == id; };
+        if (std::find_if(m_handlers->begin(), m_handlers->end(), isHandler) == m_handlers->end())
+            return false;
+
+        HandlerList& handlers = getHandlersForModification();
+        handlers.erase(std::find_if(handlers.begin(), handlers.end(), isHandler));
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        // A signal that is being emitted still holds on to the old list
+        m_handlers = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::addHandler(std::function<void()> handler)
+    {
+        const auto id = generateUniqueId();
+        getHandlersForModification().push_back({id, std::move(handler)});
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::HandlerList& Signal::getHandlersForModification()
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<HandlerList>();
+        else if (m_handlers.use_count() > 1) // The signal is being emitted, so the list can't be changed
+            m_handlers = std::make_shared<HandlerList>(*m_handlers);
+
+        return *m_handlers;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -202,16 +232,12 @@ namespace tgui
     #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return addHandler([handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
     }
 
     TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
@@ -285,25 +311,21 @@ namespace tgui
 
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         internal_signal::parameters[1] = static_cast<const void*>(&start);
@@ -325,25 +347,21 @@ namespace tgui
 
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!hasHandlers())
             return false;
 
         ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
@@ -365,54 +383,42 @@ namespace tgui
 
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemIndex& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<int>(internal_signal::parameters[3])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<int>(internal_signal::parameters[3])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemIndexEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<int>(internal_signal::parameters[3])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<int>(internal_signal::parameters[3])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -438,36 +444,28 @@ namespace tgui
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFull& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFullEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -153,7 +154,7 @@ namespace tgui
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || (!m_texture.getData()->image && !m_texture.getData()->alphaMask) || (m_size.x == 0) || (m_size.y == 0))
             return true;
 
         if (getRotation() != 0)
@@ -183,74 +184,74 @@ namespace tgui
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
+        const sf::Vector2u textureSize{sf::Vector2f{m_texture.getImageSize()}};
         switch (m_scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * textureSize.y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_size.y / textureSize.y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_size.y / textureSize.y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((textureSize.x - middleRect.width) * (m_size.y / textureSize.y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * textureSize.y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * textureSize.x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_size.x / textureSize.x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_size.x / textureSize.x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((textureSize.y - middleRect.height) * (m_size.x / textureSize.x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * textureSize.x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_size.x - (textureSize.x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + textureSize.x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (textureSize.x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_size.y - (textureSize.y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + textureSize.y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (textureSize.y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -421,6 +422,14 @@ namespace tgui
             m_vertices[21] = {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        // When the image is stored in a texture atlas, the texture coordinates have to point to its location in the atlas
+        if (m_texture.getData()->atlasTexture)
+        {
+            const sf::Vector2f atlasOffset{static_cast<float>(m_texture.getData()->atlasRect.left), static_cast<float>(m_texture.getData()->atlasRect.top)};
+            for (auto& vertex : m_vertices)
+                vertex.texCoords += atlasOffset;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -454,11 +463,13 @@ namespace tgui
 
         if (m_texture.getData()->svgImage)
             states.texture = m_svgTexture.get();
+        else if (m_texture.getData()->atlasTexture)
+            states.texture = m_texture.getData()->atlasTexture.get();
         else
             states.texture = &m_texture.getData()->texture;
 
         states.shader = m_shader;
-        target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+        RenderBatch::drawVertices(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
 
@@ -48,6 +49,7 @@ namespace tgui
     void Text::setString(const sf::String& string)
     {
         m_text.setString(string);
+        m_verticesNeedUpdate = true;
         recalculateSize();
     }
 
@@ -63,6 +65,7 @@ namespace tgui
     void Text::setCharacterSize(unsigned int size)
     {
         m_text.setCharacterSize(size);
+        m_verticesNeedUpdate = true;
         recalculateSize();
     }
 
@@ -78,6 +81,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_verticesNeedUpdate = true;
 
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
@@ -98,6 +102,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_verticesNeedUpdate = true;
 
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
@@ -142,6 +147,7 @@ namespace tgui
             }
         }
 
+        m_verticesNeedUpdate = true;
         recalculateSize();
     }
 
@@ -159,6 +165,7 @@ namespace tgui
         if (style != m_text.getStyle())
         {
             m_text.setStyle(style);
+            m_verticesNeedUpdate = true;
             recalculateSize();
         }
     }
@@ -175,6 +182,7 @@ namespace tgui
     void Text::setOutlineColor(Color color)
     {
         m_outlineColor = color;
+        m_verticesNeedUpdate = true;
 
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setOutlineColor(Color::calcColorOpacity(m_outlineColor, m_opacity));
@@ -194,6 +202,7 @@ namespace tgui
     {
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setOutlineThickness(thickness);
+        m_verticesNeedUpdate = true;
 #else
         (void)thickness;
 #endif
@@ -214,7 +223,39 @@ namespace tgui
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        if (!m_font || (m_font.getGlyphReferenceSize() == 0))
+            return m_text.findCharacterPos(index);
+
+        // The glyphs are scaled from another character size, so the position can't be asked to sf::Text which would use
+        // the metrics of the real character size. The characters are placed in the same way as updateVertices does it.
+        const sf::String& string = m_text.getString();
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
+        const float whitespaceWidth = m_font.getGlyphAdvance(' ', characterSize, bold);
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+
+        Vector2f position;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < std::min(index, string.getSize()); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            position.x += m_font.getKerning(prevChar, curChar, characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                position.x += whitespaceWidth;
+            else if (curChar == '\t')
+                position.x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                position.y += lineSpacing;
+                position.x = 0;
+            }
+            else
+                position.x += m_font.getGlyphAdvance(curChar, characterSize, bold);
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,7 +270,18 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        if (m_font == nullptr)
+            return;
+
+        updateVertices();
+        if (m_vertices.empty())
+            return;
+
+        states.texture = &m_font.getTexture(getCharacterSize());
+        if (!m_outlineVertices.empty())
+            RenderBatch::drawVertices(target, m_outlineVertices.data(), m_outlineVertices.size(), sf::PrimitiveType::Triangles, states);
+
+        RenderBatch::drawVertices(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,9 +311,9 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (m_font.getGlyphAdvance(' ', textSize, bold) * 4) + kerning;
             else
-                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += m_font.getGlyphAdvance(string[i], textSize, bold) + kerning;
 
             prevChar = string[i];
         }
@@ -273,6 +325,147 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Text::updateVertices() const
+    {
+        if (!m_verticesNeedUpdate)
+            return;
+
+        m_verticesNeedUpdate = false;
+        m_vertices.clear();
+        m_outlineVertices.clear();
+
+        const sf::String& string = m_text.getString();
+        if ((m_font == nullptr) || string.isEmpty())
+            return;
+
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const TextStyle style = m_text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+#else
+        const bool strikeThrough = false;
+#endif
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+        const float outlineThickness = getOutlineThickness();
+        const sf::Color fillColor = Color::calcColorOpacity(m_color, m_opacity);
+        const sf::Color outlineColor = Color::calcColorOpacity(m_outlineColor, m_opacity);
+
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float underlineThickness = font->getUnderlineThickness(characterSize);
+        const sf::FloatRect xBounds = m_font.getGlyph('x', characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+        const float whitespaceWidth = m_font.getGlyphAdvance(' ', characterSize, bold);
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+        const float glyphScale = m_font.getGlyphScale(characterSize);
+
+        // Adds a horizontal line (for underlined and strike-through text), the font texture contains a white pixel at (1,1)
+        const auto addLine = [](std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, sf::Color color, float offset, float thickness, float outline)
+            {
+                const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+                const float bottom = top + std::floor(thickness + 0.5f);
+
+                vertices.emplace_back(sf::Vector2f{-outline, top - outline}, color, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength + outline, top - outline}, color, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{-outline, bottom + outline}, color, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{-outline, bottom + outline}, color, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength + outline, top - outline}, color, sf::Vector2f{1, 1});
+                vertices.emplace_back(sf::Vector2f{lineLength + outline, bottom + outline}, color, sf::Vector2f{1, 1});
+            };
+
+        const auto addLines = [&](float x, float y)
+            {
+                if (underlined)
+                {
+                    addLine(m_vertices, x, y, fillColor, underlineOffset, underlineThickness, 0);
+                    if (outlineThickness != 0)
+                        addLine(m_outlineVertices, x, y, outlineColor, underlineOffset, underlineThickness, outlineThickness);
+                }
+
+                if (strikeThrough)
+                {
+                    addLine(m_vertices, x, y, fillColor, strikeThroughOffset, underlineThickness, 0);
+                    if (outlineThickness != 0)
+                        addLine(m_outlineVertices, x, y, outlineColor, strikeThroughOffset, underlineThickness, outlineThickness);
+                }
+            };
+
+        // Adds the two triangles that show a glyph, with a padding of one texture pixel to avoid cutting off anti-aliased pixels
+        const auto addGlyphQuad = [italicShear,glyphScale](std::vector<sf::Vertex>& vertices, float x, float y, sf::Color color, const sf::Glyph& glyph, float outline)
+            {
+                const float padding = 1;
+                const float left = glyph.bounds.left - padding * glyphScale;
+                const float top = glyph.bounds.top - padding * glyphScale;
+                const float right = glyph.bounds.left + glyph.bounds.width + padding * glyphScale;
+                const float bottom = glyph.bounds.top + glyph.bounds.height + padding * glyphScale;
+
+                const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+                const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+                const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+                const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+                vertices.emplace_back(sf::Vector2f{x + left - italicShear * top - outline, y + top - outline}, color, sf::Vector2f{u1, v1});
+                vertices.emplace_back(sf::Vector2f{x + right - italicShear * top - outline, y + top - outline}, color, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom - outline, y + bottom - outline}, color, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom - outline, y + bottom - outline}, color, sf::Vector2f{u1, v2});
+                vertices.emplace_back(sf::Vector2f{x + right - italicShear * top - outline, y + top - outline}, color, sf::Vector2f{u2, v1});
+                vertices.emplace_back(sf::Vector2f{x + right - italicShear * bottom - outline, y + bottom - outline}, color, sf::Vector2f{u2, v2});
+            };
+
+        m_vertices.reserve(string.getSize() * 6);
+        if (outlineThickness != 0)
+            m_outlineVertices.reserve(string.getSize() * 6);
+
+        // The glyphs are placed in the same way as sf::Text would do it, so that the result doesn't depend on batching
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            if (curChar == '\r')
+                continue;
+
+            x += m_font.getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == '\n') && (prevChar != '\n'))
+                addLines(x, y);
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            if (outlineThickness != 0)
+                addGlyphQuad(m_outlineVertices, x, y, outlineColor, m_font.getGlyph(curChar, characterSize, bold, outlineThickness), outlineThickness);
+
+            const sf::Glyph& glyph = m_font.getGlyph(curChar, characterSize, bold);
+            addGlyphQuad(m_vertices, x, y, fillColor, glyph, 0);
+            x += glyph.advance;
+        }
+
+        if (x > 0)
+            addLines(x, y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     float Text::getExtraHorizontalPadding(const Text& text)
     {
@@ -373,9 +566,9 @@ namespace tgui
             if (curChar == '\n')
                 break;
             else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
+                charWidth = font.getGlyphAdvance(' ', characterSize, bold) * 4.0f;
             else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
+                charWidth = font.getGlyphAdvance(curChar, characterSize, bold);
 
             const float kerning = font.getKerning(prevChar, curChar, characterSize);
 
@@ -435,9 +628,8 @@ namespace tgui
         const bool bold = (style & sf::Text::Bold) != 0;
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getGlyph('g', characterSize, bold).bounds.top;
+        const sf::Glyph& glyph = font.getGlyph('g', characterSize, bold);
+        const float lineHeight = characterSize + glyph.bounds.height + glyph.bounds.top;
 
         // Get the line spacing sfml returns
         const float lineSpacing = font.getLineSpacing(characterSize);
@@ -472,9 +664,9 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = font.getGlyphAdvance(' ', textSize, bold) * 4;
                 else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getGlyphAdvance(curChar, textSize, bold);
 
                 const float kerning = font.getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
@@ -130,6 +130,10 @@ namespace tgui
     {
         if (this != &other)
         {
+            // Release the texture that was stored before, just like the destructor would
+            if (getData() && (m_destructCallback != nullptr))
+                m_destructCallback(getData());
+
             m_data             = std::move(other.m_data);
             m_color            = std::move(other.m_color);
             m_shader           = std::move(other.m_shader);
@@ -227,6 +231,8 @@ namespace tgui
 
         if (m_data->svgImage)
             return m_data->svgImage->getSize();
+        else if (m_data->atlasTexture)
+            return {static_cast<float>(m_data->atlasRect.width), static_cast<float>(m_data->atlasRect.height)};
         else
             return {sf::Vector2f{m_data->texture.getSize()}};
     }
@@ -236,7 +242,25 @@ namespace tgui
     void Texture::setSmooth(bool smooth)
     {
         if (m_data)
+        {
+            // The texture atlas is never smooth, so the image has to be given its own texture.
+            // Other textures may still be using the data, so only this texture is changed to use a copy.
+            if (m_data->atlasTexture)
+            {
+                if (!smooth)
+                    return;
+
+                auto data = TextureManager::copyOutOfAtlas(*m_data);
+                if (!data)
+                    return;
+
+                setTextureData(data, m_middleRect);
+                m_copyCallback = nullptr;
+                m_destructCallback = nullptr;
+            }
+
             m_data->texture.setSmooth(smooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,7 +268,7 @@ namespace tgui
     bool Texture::isSmooth() const
     {
         if (m_data)
-            return m_data->texture.isSmooth();
+            return !m_data->atlasTexture && m_data->texture.isSmooth();
         else
             return false;
     }
@@ -300,10 +324,16 @@ namespace tgui
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || (!m_data->image && !m_data->alphaMask))
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
+
+        if (!m_data->image)
+        {
+            const ImageAlphaMask& alphaMask = *m_data->alphaMask;
+            return alphaMask.transparentPixels[(pixel.y + m_data->rect.top) * alphaMask.size.x + pixel.x + m_data->rect.left];
+        }
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -384,10 +414,7 @@ namespace tgui
 
         if (middleRect == sf::IntRect{})
         {
-            if (m_data->svgImage)
-                m_middleRect = {0, 0, static_cast<int>(m_data->svgImage->getSize().x), static_cast<int>(m_data->svgImage->getSize().y)};
-            else
-                m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
         }
         else
             m_middleRect = middleRect;
@@ -27,11 +27,93 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    namespace
+    {
+        const unsigned int atlasPageSize = 1024;
+        const unsigned int maxAtlasImageSize = 256;
+
+        // Checks whether the part of the image that has to be loaded isn't located completely outside the image
+        bool isPartInsideImage(const sf::IntRect& partRect, sf::Vector2u imageSize)
+        {
+            return (partRect == sf::IntRect{})
+                || ((partRect.left < static_cast<int>(imageSize.x)) && (partRect.top < static_cast<int>(imageSize.y)));
+        }
+
+        // Clips the part to the image, just like sf::Texture::loadFromImage does
+        sf::IntRect clipToImage(const sf::IntRect& partRect, sf::Vector2u size)
+        {
+            const sf::Vector2i imageSize{size};
+            sf::IntRect rect = partRect;
+            if ((rect.width == 0) || (rect.height == 0))
+                rect = {0, 0, imageSize.x, imageSize.y};
+
+            rect.left = std::max(rect.left, 0);
+            rect.top = std::max(rect.top, 0);
+            rect.width = std::min(rect.width, imageSize.x - rect.left);
+            rect.height = std::min(rect.height, imageSize.y - rect.top);
+            return rect;
+        }
+
+        std::shared_ptr<ImageAlphaMask> createAlphaMask(const sf::Image& image)
+        {
+            auto alphaMask = std::make_shared<ImageAlphaMask>();
+            alphaMask->size = image.getSize();
+            alphaMask->transparentPixels.resize(static_cast<std::size_t>(alphaMask->size.x) * alphaMask->size.y);
+
+            const sf::Uint8* pixels = image.getPixelsPtr();
+            for (std::size_t i = 0; i < alphaMask->transparentPixels.size(); ++i)
+                alphaMask->transparentPixels[i] = (pixels[i * 4 + 3] == 0);
+
+            return alphaMask;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::ImageMap TextureManager::m_imageMap;
+    std::unordered_map<const TextureData*, TextureManager::TextureDataLocation> TextureManager::m_textureDataLocations;
+    std::list<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+    bool TextureManager::m_atlasEnabled = false;
+    std::map<sf::String, std::shared_ptr<sf::Texture>> TextureManager::m_fileTextures;
+    TextureManager::ImageRetention TextureManager::m_imageRetention = TextureManager::ImageRetention::Image;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::AtlasPage::findSpace(sf::Vector2u size, unsigned int pageSize, sf::Vector2u& pos)
+    {
+        // Place the image on the lowest row that is high enough and still has room left
+        AtlasShelf* bestShelf = nullptr;
+        for (auto& shelf : shelves)
+        {
+            if ((size.y <= shelf.height) && (shelf.width + size.x <= pageSize) && (!bestShelf || (shelf.height < bestShelf->height)))
+                bestShelf = &shelf;
+        }
+
+        if (bestShelf)
+        {
+            pos = {bestShelf->width, bestShelf->top};
+            bestShelf->width += size.x;
+            return true;
+        }
+
+        // Start a new row below the existing ones
+        const unsigned int top = shelves.empty() ? 0 : shelves.back().top + shelves.back().height;
+        if ((top + size.y > pageSize) || (size.x > pageSize))
+            return false;
+
+        shelves.push_back({top, size.y, size.x});
+        pos = {0, top};
+        return true;
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -81,32 +163,75 @@ namespace tgui
         {
             data->svgImage = std::make_unique<SvgImage>(filename);
             if (data->svgImage->isSet())
+            {
+                m_textureDataLocations[data.get()] = {imageIt, std::prev(imageIt->second.end())};
                 return data;
+            }
         }
         else // Not an svg
         {
-            // Share the image if it was loaded before
+            // Share the pixels if the image was loaded before
             if (imageIt->second.size() >= 2)
+            {
                 data->image = imageIt->second.begin()->data->image;
+                data->alphaMask = imageIt->second.begin()->data->alphaMask;
+            }
+
+            // If the image was discarded then the texture containing the entire image is used instead
+            std::shared_ptr<sf::Texture> fileTexture;
+            if (!data->image && !m_atlasEnabled)
+            {
+                const auto fileTextureIt = m_fileTextures.find(filename);
+                if (fileTextureIt != m_fileTextures.end())
+                    fileTexture = fileTextureIt->second;
+            }
 
-            if (!data->image)
-                data->image = texture.getImageLoader()(filename);
-            if (data->image)
+            bool loaded = false;
+            if (fileTexture)
+                loaded = isPartInsideImage(partRect, fileTexture->getSize());
+            else
             {
+                if (!data->image)
+                    data->image = texture.getImageLoader()(filename);
+
                 // Create a texture from the image
-                bool loadFromImageSuccess;
-                if (partRect == sf::IntRect{})
-                    loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-                else
+                if (data->image && isPartInsideImage(partRect, data->image->getSize()))
                 {
-                    if ((partRect.left < static_cast<int>(data->image->getSize().x)) && (partRect.top < static_cast<int>(data->image->getSize().y)))
-                        loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+                    if (m_atlasEnabled && addToAtlas(*data, partRect))
+                        loaded = true;
+                    else if (m_imageRetention != ImageRetention::Image)
+                    {
+                        // All parts of the image will share a single texture, as the image won't be available for the next part
+                        fileTexture = std::make_shared<sf::Texture>();
+                        loaded = fileTexture->loadFromImage(*data->image);
+                        if (loaded)
+                            m_fileTextures[filename] = fileTexture;
+                    }
+                    else if (partRect == sf::IntRect{})
+                        loaded = data->texture.loadFromImage(*data->image);
                     else
-                        loadFromImageSuccess = false;
+                        loaded = data->texture.loadFromImage(*data->image, partRect);
+                }
+            }
+
+            if (loaded)
+            {
+                if (fileTexture)
+                {
+                    data->atlasTexture = fileTexture;
+                    data->atlasRect = clipToImage(partRect, fileTexture->getSize());
+                }
+
+                if ((m_imageRetention != ImageRetention::Image) && data->image)
+                {
+                    if ((m_imageRetention == ImageRetention::AlphaMask) && !data->alphaMask)
+                        data->alphaMask = createAlphaMask(*data->image);
+
+                    data->image = nullptr;
                 }
 
-                if (loadFromImageSuccess)
-                    return data;
+                m_textureDataLocations[data.get()] = {imageIt, std::prev(imageIt->second.end())};
+                return data;
             }
         }
 
@@ -114,7 +239,10 @@ namespace tgui
         if (imageIt->second.size() > 1)
             imageIt->second.pop_back();
         else
+        {
+            m_fileTextures.erase(filename);
             m_imageMap.erase(imageIt);
+        }
 
         return nullptr;
     }
@@ -123,50 +251,189 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        const auto locationIt = m_textureDataLocations.find(textureDataToCopy.get());
+        if (locationIt == m_textureDataLocations.end())
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(locationIt->second.dataIt->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        const auto locationIt = m_textureDataLocations.find(textureDataToRemove.get());
+        if (locationIt == m_textureDataLocations.end())
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        const TextureDataLocation location = locationIt->second;
+        if (--(location.dataIt->users) == 0)
         {
-            for (auto& data : dataHolder.second)
+            if (location.dataIt->data->atlasTexture)
+                releaseAtlasSpace(*location.dataIt->data);
+
+            m_textureDataLocations.erase(locationIt);
+
+            location.imageIt->second.erase(location.dataIt);
+            if (location.imageIt->second.empty())
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
+                m_fileTextures.erase(location.imageIt->first);
+                m_imageMap.erase(location.imageIt);
             }
         }
-
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    std::map<sf::String, TextureManager::MemoryUsage> TextureManager::getMemoryUsage()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        std::map<sf::String, MemoryUsage> memoryUsage;
+        for (const auto& image : m_imageMap)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            MemoryUsage& usage = memoryUsage[image.first];
+
+            // Textures created from different parts of the same file share the same image
+            std::unordered_set<const void*> countedImages;
+            const auto fileTextureIt = m_fileTextures.find(image.first);
+            const sf::Texture* fileTexture = (fileTextureIt != m_fileTextures.end()) ? fileTextureIt->second.get() : nullptr;
+            for (const auto& dataHolder : image.second)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
+                const TextureData& data = *dataHolder.data;
+                if (data.image && countedImages.insert(data.image.get()).second)
+                    usage.imageBytes += static_cast<std::size_t>(data.image->getSize().x) * data.image->getSize().y * 4;
 
-                    return;
+                if (data.alphaMask && countedImages.insert(data.alphaMask.get()).second)
+                    usage.alphaMaskBytes += (data.alphaMask->transparentPixels.size() + 7) / 8;
+
+                if (data.atlasTexture && (data.atlasTexture.get() == fileTexture))
+                {
+                    if (countedImages.insert(fileTexture).second)
+                        usage.textureBytes += static_cast<std::size_t>(fileTexture->getSize().x) * fileTexture->getSize().y * 4;
                 }
+                else if (data.atlasTexture)
+                    usage.textureBytes += static_cast<std::size_t>(data.atlasRect.width) * data.atlasRect.height * 4;
+                else
+                    usage.textureBytes += static_cast<std::size_t>(data.texture.getSize().x) * data.texture.getSize().y * 4;
+                usage.textures++;
+                usage.users += dataHolder.users;
             }
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        return memoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setImageRetention(ImageRetention retention)
+    {
+        m_imageRetention = retention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::ImageRetention TextureManager::getImageRetention()
+    {
+        return m_imageRetention;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::copyOutOfAtlas(const TextureData& data)
+    {
+        auto copy = std::make_shared<TextureData>();
+        copy->image = data.image;
+        copy->alphaMask = data.alphaMask;
+        copy->rect = data.rect;
+#ifndef TGUI_NEXT
+        copy->shader = data.shader;
+#endif
+
+        bool loaded;
+        if (data.image)
+            loaded = copy->texture.loadFromImage(*data.image, data.rect);
+        else
+            loaded = copy->texture.loadFromImage(data.atlasTexture->copyToImage(), data.atlasRect);
+
+        if (!loaded)
+            return nullptr;
+
+        return copy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data, const sf::IntRect& partRect)
+    {
+        const sf::IntRect rect = clipToImage(partRect, data.image->getSize());
+        if ((rect.width <= 0) || (rect.height <= 0)
+         || (rect.width > static_cast<int>(maxAtlasImageSize)) || (rect.height > static_cast<int>(maxAtlasImageSize)))
+            return false;
+
+        const unsigned int pageSize = std::min(atlasPageSize, sf::Texture::getMaximumSize());
+
+        // Leave an empty pixel next to every image so that the borders of neighbouring images are never sampled
+        const sf::Vector2u size{static_cast<unsigned int>(rect.width) + 1, static_cast<unsigned int>(rect.height) + 1};
+
+        sf::Vector2u pos;
+        auto pageIt = m_atlasPages.begin();
+        while ((pageIt != m_atlasPages.end()) && !pageIt->findSpace(size, pageSize, pos))
+            ++pageIt;
+
+        if (pageIt == m_atlasPages.end())
+        {
+            AtlasPage page;
+            page.texture = std::make_shared<sf::Texture>();
+            if (!page.texture->create(pageSize, pageSize) || !page.findSpace(size, pageSize, pos))
+                return false;
+
+            m_atlasPages.push_back(std::move(page));
+            pageIt = std::prev(m_atlasPages.end());
+        }
+
+        sf::Image part;
+        part.create(static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height));
+        part.copy(*data.image, 0, 0, rect);
+        pageIt->texture->update(part, pos.x, pos.y);
+        ++pageIt->images;
+
+        data.atlasTexture = pageIt->texture;
+        data.atlasRect = {static_cast<int>(pos.x), static_cast<int>(pos.y), rect.width, rect.height};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseAtlasSpace(TextureData& data)
+    {
+        for (auto pageIt = m_atlasPages.begin(); pageIt != m_atlasPages.end(); ++pageIt)
+        {
+            if (pageIt->texture != data.atlasTexture)
+                continue;
+
+            if (--pageIt->images == 0)
+                m_atlasPages.erase(pageIt);
+
+            break;
+        }
+
+        data.atlasTexture = nullptr;
+        data.atlasRect = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
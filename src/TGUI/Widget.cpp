@@ -29,8 +29,8 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/SignalManager.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -128,10 +128,10 @@ namespace tgui
             m_renderer->unsubscribe(this);
 
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         SignalManager::getSignalManager()->remove(this);
     }
@@ -378,6 +378,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,11 +438,16 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            // Both the old and the new area of the widget have to be redrawn
+            if (m_parent && m_visible)
+                m_parent->childInvalidated({getAbsolutePosition() - getPosition() + m_prevPosition, getFullSize()});
+
             m_prevPosition = getPosition();
+            invalidate();
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
     }
 
@@ -454,11 +461,15 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            if (m_parent && m_visible)
+                m_parent->childInvalidated({getAbsolutePosition(), getFullSize() - getSize() + m_prevSize});
+
             m_prevSize = getSize();
+            invalidate();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
     }
 
@@ -488,6 +499,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isDrawnWithinBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isMouseOnWidgetWithinBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::wasInvalidatedWithoutParent()
+    {
+        const bool invalidated = m_invalidatedWithoutParent;
+        m_invalidatedWithoutParent = false;
+        return invalidated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::showWithEffect(ShowAnimationType type, sf::Time duration)
     {
         setVisible(true);
@@ -660,8 +694,15 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
+        // The area has to be marked for redrawing while the widget is visible, so before hiding it or after showing it
+        if (!visible)
+            invalidate();
+
         m_visible = visible;
 
+        if (visible)
+            invalidate();
+
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
             setFocused(false);
@@ -672,6 +713,7 @@ namespace tgui
     void Widget::setEnabled(bool enabled)
     {
         m_enabled = enabled;
+        invalidate();
 
         if (!enabled)
         {
@@ -692,6 +734,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidate();
+
         if (focused)
         {
             if (canGainFocus())
@@ -747,6 +791,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -762,6 +807,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -851,6 +897,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        if (m_parent)
+        {
+            m_parent->childChanged(*this);
+
+            if (m_visible)
+                m_parent->childInvalidated({getAbsolutePosition(), getFullSize()});
+        }
+        else
+            m_invalidatedWithoutParent = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
         if (!parent)
@@ -1247,6 +1308,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1255,6 +1317,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -1263,6 +1326,7 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1272,14 +1336,15 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
+        const Color fillColor = (m_opacityCached < 1) ? Color::calcColorOpacity(color, m_opacityCached) : color;
+        const sf::Vertex vertices[4] = {
+            {{0, 0}, fillColor},
+            {{0, size.y}, fillColor},
+            {{size.x, 0}, fillColor},
+            {{size.x, size.y}, fillColor}
+        };
 
-        if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
-
-        target.draw(shape, states);
+        RenderBatch::drawVertices(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1295,10 +1360,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[4] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            RenderBatch::drawVertices(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1325,7 +1394,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            RenderBatch::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
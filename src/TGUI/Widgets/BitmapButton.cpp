@@ -72,6 +72,8 @@ namespace tgui
 
     void BitmapButton::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
         m_text.setCharacterSize(m_textSize);
@@ -84,6 +86,8 @@ namespace tgui
 
     void BitmapButton::setImage(const Texture& image)
     {
+        invalidate();
+
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
@@ -100,6 +104,8 @@ namespace tgui
 
     void BitmapButton::setImageScaling(float relativeHeight)
     {
+        invalidate();
+
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
     }
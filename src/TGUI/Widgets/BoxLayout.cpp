@@ -78,6 +78,8 @@ namespace tgui
 
     void BoxLayout::add(const Widget::Ptr& widget, const sf::String& widgetName)
     {
+        invalidate();
+
         insert(m_widgets.size(), widget, widgetName);
     }
 
@@ -85,6 +87,8 @@ namespace tgui
 
     void BoxLayout::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
     {
+        invalidate();
+
         // Move the widget to the right position
         if (index < m_widgets.size())
         {
@@ -104,6 +108,8 @@ namespace tgui
 
     bool BoxLayout::remove(const Widget::Ptr& widget)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i] == widget)
@@ -117,6 +123,8 @@ namespace tgui
 
     bool BoxLayout::remove(std::size_t index)
     {
+        invalidate();
+
         if (index >= m_widgets.size())
             return false;
 
@@ -138,6 +146,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BoxLayout::postponedUpdateWidgets()
+    {
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BoxLayout::rendererChanged(const std::string& property)
     {
         if (property == "spacebetweenwidgets")
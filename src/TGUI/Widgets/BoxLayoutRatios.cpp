@@ -40,6 +40,8 @@ namespace tgui
 
     void BoxLayoutRatios::add(const Widget::Ptr& widget, const sf::String& widgetName)
     {
+        invalidate();
+
         insert(m_widgets.size(), widget, 1, widgetName);
     }
 
@@ -47,6 +49,8 @@ namespace tgui
 
     void BoxLayoutRatios::add(const Widget::Ptr& widget, float ratio, const sf::String& widgetName)
     {
+        invalidate();
+
         insert(m_widgets.size(), widget, ratio, widgetName);
     }
 
@@ -54,6 +58,8 @@ namespace tgui
 
     void BoxLayoutRatios::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
     {
+        invalidate();
+
         insert(index, widget, 1, widgetName);
     }
 
@@ -61,6 +67,8 @@ namespace tgui
 
     void BoxLayoutRatios::insert(std::size_t index, const Widget::Ptr& widget, float ratio, const sf::String& widgetName)
     {
+        invalidate();
+
         if (index < m_ratios.size())
             m_ratios.insert(m_ratios.begin() + index, ratio);
         else
@@ -73,6 +81,8 @@ namespace tgui
 
     bool BoxLayoutRatios::remove(std::size_t index)
     {
+        invalidate();
+
         if (index < m_ratios.size())
             m_ratios.erase(m_ratios.begin() + index);
 
@@ -83,6 +93,8 @@ namespace tgui
 
     void BoxLayoutRatios::removeAllWidgets()
     {
+        invalidate();
+
         BoxLayout::removeAllWidgets();
         m_ratios.clear();
     }
@@ -91,6 +103,8 @@ namespace tgui
 
     void BoxLayoutRatios::addSpace(float ratio)
     {
+        invalidate();
+
         insertSpace(m_widgets.size(), ratio);
     }
 
@@ -98,6 +112,8 @@ namespace tgui
 
     void BoxLayoutRatios::insertSpace(std::size_t index, float ratio)
     {
+        invalidate();
+
         insert(index, Group::create(), ratio, "#TGUI_INTERNAL$HorizontalLayoutSpace#");
     }
 
@@ -105,6 +121,8 @@ namespace tgui
 
     bool BoxLayoutRatios::setRatio(Widget::Ptr widget, float ratio)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i] == widget)
@@ -118,6 +136,8 @@ namespace tgui
 
     bool BoxLayoutRatios::setRatio(std::size_t index, float ratio)
     {
+        invalidate();
+
         if (index >= m_ratios.size())
             return false;
 
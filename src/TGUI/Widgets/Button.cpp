@@ -114,6 +114,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
 
@@ -173,6 +175,8 @@ namespace tgui
 
     void Button::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if (size != m_textSize)
         {
             m_textSize = size;
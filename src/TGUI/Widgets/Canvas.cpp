@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/RenderBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -125,6 +126,8 @@ namespace tgui
 
     void Canvas::setView(const sf::View& view)
     {
+        invalidate();
+
         m_renderTexture.setView(view);
     }
 
@@ -181,6 +184,8 @@ namespace tgui
 
     void Canvas::display()
     {
+        invalidate();
+
         m_renderTexture.display();
     }
 
@@ -202,7 +207,7 @@ namespace tgui
             return;
 
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        RenderBatch::drawDrawable(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -115,6 +117,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text)
     {
+        invalidate();
+
         addLine(text, m_textColor, m_textStyle);
     }
 
@@ -122,6 +126,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, Color color)
     {
+        invalidate();
+
         addLine(text, color, m_textStyle);
     }
 
@@ -129,6 +135,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, Color color, TextStyle style)
     {
+        invalidate();
+
         // Remove the oldest line if you exceed the maximum
         if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
         {
@@ -149,10 +157,21 @@ namespace tgui
 
         recalculateLineText(line);
 
+        // The offsets of the other lines don't change when adding a line at the top or bottom
         if (m_newLinesBelowOthers)
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.back().top + static_cast<double>(m_lines.back().text.getSize().y);
+
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            if (!m_lines.empty())
+                line.top = m_lines.front().top - static_cast<double>(line.text.getSize().y);
+
             m_lines.push_front(std::move(line));
+        }
 
         recalculateFullTextHeight();
     }
@@ -195,10 +214,16 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
+        invalidate();
+
         if (lineIndex < m_lines.size())
         {
             m_lines.erase(m_lines.begin() + lineIndex);
 
+            // Only the lines below the removed line have to be moved, unless it was the first line
+            if ((lineIndex > 0) && (lineIndex < m_lines.size()))
+                recalculateLineOffsets(lineIndex);
+
             recalculateFullTextHeight();
             return true;
         }
@@ -210,6 +235,8 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
+        invalidate();
+
         m_lines.clear();
 
         recalculateFullTextHeight();
@@ -226,6 +253,8 @@ namespace tgui
 
     void ChatBox::setLineLimit(std::size_t maxLines)
     {
+        invalidate();
+
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
@@ -251,6 +280,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         m_scroll->setScrollAmount(size);
 
@@ -264,6 +295,8 @@ namespace tgui
 
     void ChatBox::setTextColor(Color color)
     {
+        invalidate();
+
         m_textColor = color;
     }
 
@@ -278,6 +311,8 @@ namespace tgui
 
     void ChatBox::setTextStyle(TextStyle style)
     {
+        invalidate();
+
         m_textStyle = style;
     }
 
@@ -292,6 +327,8 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        invalidate();
+
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
     }
@@ -307,6 +344,8 @@ namespace tgui
 
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
+        invalidate();
+
         m_newLinesBelowOthers = newLinesBelowOthers;
     }
 
@@ -321,6 +360,8 @@ namespace tgui
 
     void ChatBox::setScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_scroll->setValue(value);
     }
 
@@ -376,6 +417,10 @@ namespace tgui
             m_scroll->mouseMoved(pos - getPosition());
         else
             m_scroll->mouseNoLongerOnWidget();
+
+        // The scrollbar isn't added to a container, so the chat box has to be redrawn when the scrollbar changed
+        if (m_scroll->wasInvalidatedWithoutParent())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,16 +473,31 @@ namespace tgui
         for (auto& line : m_lines)
             recalculateLineText(line);
 
+        recalculateLineOffsets(0);
         recalculateFullTextHeight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::recalculateLineOffsets(std::size_t firstLine)
+    {
+        for (std::size_t i = firstLine; i < m_lines.size(); ++i)
+        {
+            if (i > 0)
+                m_lines[i].top = m_lines[i-1].top + static_cast<double>(m_lines[i-1].text.getSize().y);
+            else
+                m_lines[i].top = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        if (!m_lines.empty())
+            m_fullTextHeight = static_cast<float>(m_lines.back().top - m_lines.front().top) + m_lines.back().text.getSize().y;
+        else
+            m_fullTextHeight = 0;
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -652,10 +712,22 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        if (m_lines.empty())
+            return;
+
+        // Only draw the lines that lie inside the visible area. The first one is found with a binary search on the line offsets.
+        const double firstLineTop = m_lines.front().top;
+        const double visibleTop = firstLineTop + m_scroll->getValue();
+        const double visibleBottom = visibleTop + static_cast<double>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom());
+        auto lineIt = std::partition_point(m_lines.begin(), m_lines.end(),
+            [visibleTop](const Line& line){ return line.top + static_cast<double>(line.text.getSize().y) <= visibleTop; });
+
+        for (; (lineIt != m_lines.end()) && (lineIt->top < visibleBottom); ++lineIt)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            const float offset = static_cast<float>(lineIt->top - firstLineTop);
+            states.transform.translate(0, offset);
+            lineIt->text.draw(target, states);
+            states.transform.translate(0, -offset);
         }
     }
 
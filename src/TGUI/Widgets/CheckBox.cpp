@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
 
@@ -111,6 +112,8 @@ namespace tgui
 
     void CheckBox::setChecked(bool checked)
     {
+        invalidate();
+
         if (checked && !m_checked)
         {
             m_checked = true;
@@ -258,7 +261,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                RenderBatch::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
@@ -206,6 +206,8 @@ namespace tgui
 
     void ChildWindow::setMaximumSize(Vector2f size)
     {
+        invalidate();
+
         if ((size.x < getSize().x) || (size.y < getSize().y))
         {
             // The window is currently larger than the new maximum size, lets downsize
@@ -226,6 +228,8 @@ namespace tgui
 
     void ChildWindow::setMinimumSize(Vector2f size)
     {
+        invalidate();
+
         if ((size.x > getSize().x) || (size.y > getSize().y))
         {
             // The window is currently smaller than the new minimum size, lets upsize
@@ -246,6 +250,8 @@ namespace tgui
 
     void ChildWindow::setTitle(const sf::String& title)
     {
+        invalidate();
+
         m_titleText.setString(title);
 
         // Reposition the images and text
@@ -263,6 +269,8 @@ namespace tgui
 
     void ChildWindow::setTitleTextSize(unsigned int size)
     {
+        invalidate();
+
         m_titleTextSize = size;
 
         if (m_titleTextSize)
@@ -282,6 +290,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidate();
+
         m_titleAlignment = alignment;
 
         // Reposition the images and text
@@ -299,6 +309,8 @@ namespace tgui
 
     void ChildWindow::setTitleButtons(unsigned int buttons)
     {
+        invalidate();
+
         m_titleButtons = buttons;
 
         if (m_titleButtons & TitleButton::Close)
@@ -373,6 +385,8 @@ namespace tgui
 
     void ChildWindow::setResizable(bool resizable)
     {
+        invalidate();
+
         m_resizable = resizable;
     }
 
@@ -387,6 +401,8 @@ namespace tgui
 
     void ChildWindow::setPositionLocked(bool positionLocked)
     {
+        invalidate();
+
         m_positionLocked = positionLocked;
     }
 
@@ -401,6 +417,8 @@ namespace tgui
 
     void ChildWindow::setKeepInParent(bool enabled)
     {
+        invalidate();
+
         m_keepInParent = enabled;
 
         if (enabled)
@@ -461,6 +479,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ChildWindow::isDrawnWithinBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChildWindow::isMouseOnWidgetWithinBounds() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::leftMousePressed(Vector2f pos)
     {
         pos -= getPosition();
@@ -686,6 +718,17 @@ namespace tgui
                             button->mouseNoLongerOnWidget();
                     }
                 }
+
+                // The title bar buttons aren't child widgets, so the window has to be redrawn when their hover state changed
+                bool buttonChanged = false;
+                for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+                {
+                    if (button->wasInvalidatedWithoutParent())
+                        buttonChanged = true;
+                }
+
+                if (buttonChanged)
+                    invalidate();
             }
         }
     }
@@ -26,6 +26,7 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
 
@@ -244,9 +245,11 @@ namespace tgui
 
     void ComboBox::setItemsToDisplay(std::size_t nrOfItemsInList)
     {
+        invalidate();
+
         m_nrOfItemsToDisplay = nrOfItemsInList;
 
-        if (m_nrOfItemsToDisplay < m_listBox->getItemCount())
+        if (m_nrOfItemsToDisplay < m_listBox->getFilteredItemCount())
             updateListBoxHeight();
     }
 
@@ -268,6 +271,8 @@ namespace tgui
 
     bool ComboBox::addItem(const sf::String& item, const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->addItem(item, id);
         updateListBoxHeight();
         return ret;
@@ -277,6 +282,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItem(itemName);
@@ -292,6 +299,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemById(const sf::String& id)
     {
+        invalidate();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItemById(id);
@@ -307,6 +316,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
@@ -322,6 +333,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidate();
+
         m_text.setString("");
         m_listBox->deselectItem();
     }
@@ -330,6 +343,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         // Implemented like removeItemByIndex instead of like removeItemById because m_listBox->getItems() may be slow
 
         const bool ret = m_listBox->removeItem(itemName);
@@ -337,7 +352,7 @@ namespace tgui
         m_text.setString(m_listBox->getSelectedItem());
 
         // Shrink the list size
-        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getFilteredItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
         return ret;
@@ -347,26 +362,31 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        invalidate();
 
-        return false;
+        const bool ret = m_listBox->removeItemById(id);
+
+        m_text.setString(m_listBox->getSelectedItem());
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getFilteredItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
+
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
 
         // Shrink the list size
-        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getFilteredItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
         return ret;
@@ -376,6 +396,8 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
+        invalidate();
+
         m_text.setString("");
         m_listBox->removeAllItems();
 
@@ -414,6 +436,8 @@ namespace tgui
 
     bool ComboBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -423,6 +447,8 @@ namespace tgui
 
     bool ComboBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -432,6 +458,8 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -455,6 +483,8 @@ namespace tgui
 
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         m_listBox->setMaximumItems(maximumItems);
     }
 
@@ -469,6 +499,8 @@ namespace tgui
 
     void ComboBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
         m_defaultText.setCharacterSize(m_listBox->getTextSize());
@@ -485,6 +517,8 @@ namespace tgui
 
     void ComboBox::setDefaultText(const sf::String& defaultText)
     {
+        invalidate();
+
         m_defaultText.setString(defaultText);
     }
 
@@ -499,6 +533,8 @@ namespace tgui
 
     void ComboBox::setExpandDirection(ExpandDirection direction)
     {
+        invalidate();
+
         m_expandDirection = direction;
     }
 
@@ -513,22 +549,53 @@ namespace tgui
 
     bool ComboBox::contains(const sf::String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const sf::String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setItemIndexingEnabled(bool enabled)
+    {
+        m_listBox->setItemIndexingEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isItemIndexingEnabled() const
+    {
+        return m_listBox->isItemIndexingEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setItemFilter(const sf::String& filter)
+    {
+        invalidate();
+
+        m_listBox->setItemFilter(filter);
+        updateListBoxHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ComboBox::getItemFilter() const
+    {
+        return m_listBox->getItemFilter();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ComboBox::setChangeItemOnScroll(bool changeOnScroll)
     {
+        invalidate();
+
         m_changeItemOnScroll = changeOnScroll;
     }
 
@@ -859,10 +926,10 @@ namespace tgui
         const Padding padding = m_listBox->getSharedRenderer()->getPadding();
 
         if (m_nrOfItemsToDisplay > 0)
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getItemCount(), 1))))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * (std::min<std::size_t>(m_nrOfItemsToDisplay, std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
         else
-            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getItemCount(), 1))
+            m_listBox->setSize({getSize().x, (m_listBox->getItemHeight() * std::max<std::size_t>(m_listBox->getFilteredItemCount(), 1))
                                              + borders.getTop() + borders.getBottom() + padding.getTop() + padding.getBottom()});
 
     }
@@ -995,7 +1062,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            RenderBatch::drawDrawable(target, arrow, states);
         }
 
         // Draw the selected item
@@ -43,6 +43,62 @@ namespace tgui
     const std::string EditBox::Validator::Float = "[+-]?[0-9]*\\.?[0-9]*";
 #endif
 
+    namespace
+    {
+        // Checks the text in the same way as the Int, UInt and Float regexes would do it
+        bool isNumber(const sf::String& text, bool allowSign, bool allowDecimalPoint)
+        {
+            std::size_t i = 0;
+            if (allowSign && !text.isEmpty() && ((text[0] == '+') || (text[0] == '-')))
+                ++i;
+
+            bool decimalPointFound = false;
+            for (; i < text.getSize(); ++i)
+            {
+                if ((text[i] >= '0') && (text[i] <= '9'))
+                    continue;
+
+                if (allowDecimalPoint && (text[i] == '.') && !decimalPointFound)
+                    decimalPointFound = true;
+                else
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Checks whether a number stays valid when the characters in the erased range are replaced by the key.
+        // Removing characters from a valid number always leaves a valid number, so only the inserted character has to be checked.
+        bool isNumberCharacterValid(const sf::String& text, std::size_t eraseStart, std::size_t eraseCount, std::uint32_t key,
+                                    bool allowSign, bool allowDecimalPoint)
+        {
+            // Nothing can be inserted in front of a sign
+            if (eraseStart == 0)
+            {
+                const std::size_t firstRemaining = eraseCount;
+                if ((firstRemaining < text.getSize()) && ((text[firstRemaining] == '+') || (text[firstRemaining] == '-')))
+                    return false;
+            }
+
+            if ((key >= '0') && (key <= '9'))
+                return true;
+            else if (allowSign && ((key == '+') || (key == '-')))
+                return (eraseStart == 0);
+            else if (allowDecimalPoint && (key == '.'))
+            {
+                for (std::size_t i = 0; i < text.getSize(); ++i)
+                {
+                    if ((text[i] == '.') && ((i < eraseStart) || (i >= eraseStart + eraseCount)))
+                        return false;
+                }
+
+                return true;
+            }
+            else
+                return false;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     EditBox::EditBox()
@@ -147,6 +203,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
@@ -168,12 +226,12 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
-            m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
+        if (!isTextValid(text))
             m_text = "";
+        else if (m_validatorType == ValidatorType::Regex)
+            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
+        else
+            m_text = text;
 
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
@@ -244,6 +302,8 @@ namespace tgui
 
     void EditBox::setDefaultText(const sf::String& text)
     {
+        invalidate();
+
         m_defaultText.setString(text);
     }
 
@@ -258,6 +318,8 @@ namespace tgui
 
     void EditBox::selectText(std::size_t start, std::size_t length)
     {
+        invalidate();
+
         m_selStart = start;
         m_selEnd = std::min(m_text.getSize(), start + length);
         updateSelection();
@@ -274,6 +336,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
 
@@ -292,6 +356,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        invalidate();
+
         // Change the password character
         m_passwordChar = passwordChar;
 
@@ -310,6 +376,8 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -344,6 +412,8 @@ namespace tgui
 
     void EditBox::setAlignment(Alignment alignment)
     {
+        invalidate();
+
         m_textAlignment = alignment;
         setText(m_text);
     }
@@ -399,6 +469,8 @@ namespace tgui
 
     void EditBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -413,6 +485,8 @@ namespace tgui
 
     void EditBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
@@ -434,15 +508,31 @@ namespace tgui
 
     bool EditBox::setInputValidator(const std::string& regex)
     {
-        try
-        {
-            m_regex = regex;
-        }
-        catch (const std::regex_error&)
+        invalidate();
+
+        if (regex == Validator::All)
+            m_validatorType = ValidatorType::All;
+        else if (regex == Validator::Int)
+            m_validatorType = ValidatorType::Int;
+        else if (regex == Validator::UInt)
+            m_validatorType = ValidatorType::UInt;
+        else if (regex == Validator::Float)
+            m_validatorType = ValidatorType::Float;
+        else
         {
-            return false;
+            try
+            {
+                m_regex = regex;
+            }
+            catch (const std::regex_error&)
+            {
+                return false;
+            }
+
+            m_validatorType = ValidatorType::Regex;
         }
 
+        m_validatorFunction = nullptr;
         m_regexString = regex;
         setText(m_text);
         return true;
@@ -457,8 +547,31 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::setInputValidatorFunction(const std::function<bool(const sf::String& text)>& validator)
+    {
+        invalidate();
+
+        m_validatorFunction = validator;
+        if (validator)
+        {
+            m_validatorType = ValidatorType::Function;
+            m_regexString = "";
+        }
+        else
+        {
+            m_validatorType = ValidatorType::All;
+            m_regexString = Validator::All;
+        }
+
+        setText(m_text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::setSuffix(const sf::String& suffix)
     {
+        invalidate();
+
         m_textSuffix.setString(suffix);
         recalculateTextPositions();
     }
@@ -903,24 +1016,9 @@ namespace tgui
         if (m_readOnly)
             return;
 
-        // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        // Only add the character when the validator accepts it
+        if (!isCharacterValid(key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -1137,7 +1235,7 @@ namespace tgui
                 node->propertyValuePairs["Alignment"] = std::make_unique<DataIO::ValueNode>("Right");
         }
 
-        if (getInputValidator() != ".*")
+        if ((m_validatorType != ValidatorType::All) && (m_validatorType != ValidatorType::Function))
         {
             if (getInputValidator() == EditBox::Validator::Int)
                 node->propertyValuePairs["InputValidator"] = std::make_unique<DataIO::ValueNode>("Int");
@@ -1290,9 +1388,9 @@ namespace tgui
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, textSize, bold);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize);
             if (width + charWidth < posX)
@@ -1345,6 +1443,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isTextValid(const sf::String& text) const
+    {
+        switch (m_validatorType)
+        {
+        case ValidatorType::All:
+            return true;
+        case ValidatorType::Int:
+            return isNumber(text, true, false);
+        case ValidatorType::UInt:
+            return isNumber(text, false, false);
+        case ValidatorType::Float:
+            return isNumber(text, true, true);
+        case ValidatorType::Regex:
+            return std::regex_match(text.toAnsiString(), m_regex);
+        case ValidatorType::Function:
+            return m_validatorFunction(text);
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isCharacterValid(std::uint32_t key) const
+    {
+        const std::size_t pos = (m_selChars > 0) ? std::min(m_selStart, m_selEnd) : m_selEnd;
+        switch (m_validatorType)
+        {
+        case ValidatorType::All:
+            return true;
+        case ValidatorType::Int:
+            return isNumberCharacterValid(m_text, pos, m_selChars, key, true, false);
+        case ValidatorType::UInt:
+            return isNumberCharacterValid(m_text, pos, m_selChars, key, false, false);
+        case ValidatorType::Float:
+            return isNumberCharacterValid(m_text, pos, m_selChars, key, true, true);
+        default: // Regexes and custom functions need the entire text
+        {
+            sf::String text = m_text;
+            text.erase(pos, m_selChars);
+            text.insert(pos, key);
+            return isTextValid(text);
+        }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::recalculateTextPositions()
     {
         const float textOffset = m_textFull.getExtraHorizontalPadding();
@@ -1500,6 +1646,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
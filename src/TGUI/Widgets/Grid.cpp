@@ -163,6 +163,8 @@ namespace tgui
 
     void Grid::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -181,6 +183,8 @@ namespace tgui
 
     bool Grid::remove(const Widget::Ptr& widget)
     {
+        invalidate();
+
         const auto callbackIt = m_connectedCallbacks.find(widget);
         if (callbackIt != m_connectedCallbacks.end())
         {
@@ -241,6 +245,8 @@ namespace tgui
 
     void Grid::removeAllWidgets()
     {
+        invalidate();
+
         Container::removeAllWidgets();
 
         m_gridWidgets.clear();
@@ -259,8 +265,10 @@ namespace tgui
 
     void Grid::addWidget(const Widget::Ptr& widget, std::size_t row, std::size_t col, const Padding& padding, Alignment alignment)
     {
+        invalidate();
+
         // If the widget hasn't already been added then add it now
-        if (std::find(getWidgets().begin(), getWidgets().end(), widget) == getWidgets().end())
+        if (widget->getParent() != this)
             add(widget);
 
         // Create the row if it did not exist yet
@@ -331,6 +339,8 @@ namespace tgui
 
     void Grid::setWidgetPadding(const Widget::Ptr& widget, const Padding& padding)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
         {
@@ -346,6 +356,8 @@ namespace tgui
 
     void Grid::setWidgetPadding(std::size_t row, std::size_t col, const Padding& padding)
     {
+        invalidate();
+
         if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
         {
             // Change padding of the widget
@@ -387,6 +399,8 @@ namespace tgui
 
     void Grid::setWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
+        invalidate();
+
         // Find the widget in the grid
         for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
         {
@@ -402,6 +416,8 @@ namespace tgui
 
     void Grid::setWidgetAlignment(std::size_t row, std::size_t col, Alignment alignment)
     {
+        invalidate();
+
         if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
         {
             m_objAlignment[row][col] = alignment;
@@ -639,6 +655,9 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
+        if (postponeUpdateWidgets())
+            return;
+
         Vector2f position;
 
         // Fill the entire space when a size was given
@@ -738,6 +757,9 @@ namespace tgui
 
     void Grid::updateWidgets()
     {
+        if (postponeUpdateWidgets())
+            return;
+
         // Reset the column widths
         for (float& width : m_columnWidth)
             width = 0;
@@ -784,6 +806,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Grid::postponedUpdateWidgets()
+    {
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Grid::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
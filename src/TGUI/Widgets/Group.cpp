@@ -135,6 +135,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Group::isDrawnWithinBounds() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Group::leftMousePressed(Vector2f pos)
     {
         m_mouseDown = true;
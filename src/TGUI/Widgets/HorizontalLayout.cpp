@@ -62,6 +62,9 @@ namespace tgui
 
     void HorizontalLayout::updateWidgets()
     {
+        if (postponeUpdateWidgets())
+            return;
+
         const float totalSpaceBetweenWidgets = (m_spaceBetweenWidgetsCached * m_widgets.size()) - m_spaceBetweenWidgetsCached;
         const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
                                           getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -116,6 +117,8 @@ namespace tgui
 
     void Knob::setStartRotation(float startRotation)
     {
+        invalidate();
+
         while (startRotation >= 360)
             startRotation -= 360;
         while (startRotation < 0)
@@ -138,6 +141,8 @@ namespace tgui
 
     void Knob::setEndRotation(float endRotation)
     {
+        invalidate();
+
         while (endRotation >= 360)
             endRotation -= 360;
         while (endRotation < 0)
@@ -160,6 +165,8 @@ namespace tgui
 
     void Knob::setMinimum(int minimum)
     {
+        invalidate();
+
         if (m_minimum != minimum)
         {
             // Set the new minimum
@@ -189,6 +196,8 @@ namespace tgui
 
     void Knob::setMaximum(int maximum)
     {
+        invalidate();
+
         if (m_maximum != maximum)
         {
             // Set the new maximum
@@ -221,6 +230,8 @@ namespace tgui
 
     void Knob::setValue(int value)
     {
+        invalidate();
+
         if (m_value != value)
         {
             // Set the new value
@@ -250,6 +261,8 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        invalidate();
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
@@ -578,7 +591,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            RenderBatch::drawDrawable(target, bordersShape, states);
         }
 
         // Draw the background
@@ -588,7 +601,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            RenderBatch::drawDrawable(target, background, states);
         }
 
         // Draw the foreground
@@ -610,7 +623,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            RenderBatch::drawDrawable(target, thumb, states);
         }
     }
 
@@ -117,6 +117,8 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        invalidate();
+
         m_string = string;
         rearrangeText();
     }
@@ -132,6 +134,8 @@ namespace tgui
 
     void Label::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if (size != m_textSize)
         {
             m_textSize = size;
@@ -143,6 +147,8 @@ namespace tgui
 
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
+        invalidate();
+
         m_horizontalAlignment = alignment;
         rearrangeText();
     }
@@ -158,6 +164,8 @@ namespace tgui
 
     void Label::setVerticalAlignment(VerticalAlignment alignment)
     {
+        invalidate();
+
         m_verticalAlignment = alignment;
         rearrangeText();
     }
@@ -173,6 +181,8 @@ namespace tgui
 
     void Label::setScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_scrollbarPolicy = policy;
 
         // The policy only has an effect when not auto-sizing
@@ -191,6 +201,8 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize == autoSize)
             return;
 
@@ -209,6 +221,8 @@ namespace tgui
 
     void Label::setMaximumTextWidth(float maximumWidth)
     {
+        invalidate();
+
         if (m_maximumTextWidth == maximumWidth)
             return;
 
@@ -325,6 +339,10 @@ namespace tgui
             if (m_scrollbar->isShown())
                 m_scrollbar->mouseNoLongerOnWidget();
         }
+
+        // The scrollbar isn't added to a container, so the label has to be redrawn when the scrollbar changed
+        if (m_scrollbar->wasInvalidatedWithoutParent())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
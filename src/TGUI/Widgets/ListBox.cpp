@@ -25,11 +25,20 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        std::u32string toIndexKey(const sf::String& str)
+        {
+            return {str.begin(), str.end()};
+        }
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -98,8 +107,19 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
+        if (m_itemFilter.isEmpty())
+        {
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
+        }
+        else
+        {
+            for (std::size_t row = 0; row < m_filteredItems.size(); ++row)
+            {
+                Text& item = m_items[m_filteredItems[row]];
+                item.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - item.getSize().y) / 2.0f)});
+            }
+        }
 
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
@@ -125,10 +145,15 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        invalidate();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
-            m_scroll->setMaximum(static_cast<unsigned int>((m_items.size() + 1) * m_itemHeight));
+            const bool shown = m_itemFilter.isEmpty() || itemPassesFilter(itemName);
+            const std::size_t row = getFilteredItemCount();
+            if (shown)
+                m_scroll->setMaximum(static_cast<unsigned int>((row + 1) * m_itemHeight));
 
             // Scroll down when auto-scrolling is enabled
             if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
@@ -142,7 +167,17 @@ namespace tgui
             newItem.setStyle(m_textStyleCached);
             newItem.setCharacterSize(m_textSize);
             newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
+            newItem.setPosition({0, (row * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
+
+            if (!m_itemFilter.isEmpty() && shown)
+                m_filteredItems.push_back(m_items.size());
+
+            // An item that is added at the back doesn't change the index of the existing items
+            if (m_itemIndexingEnabled && !m_itemIndexOutdated)
+            {
+                m_itemIndexByText.emplace(toIndexKey(itemName), m_items.size());
+                m_itemIndexById.emplace(toIndexKey(id), m_items.size());
+            }
 
             // Add the new item to the list
             m_items.push_back(std::move(newItem));
@@ -157,11 +192,11 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -172,11 +207,11 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -187,6 +222,8 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         if (index >= m_items.size())
         {
             deselectItem();
@@ -195,11 +232,15 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_scroll->getValue())
-            m_scroll->setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
-            m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
+        // Move the scrollbar (unless the item is hidden by the filter)
+        const int row = getItemRow(m_selectedItem);
+        if (row < 0)
+            return true;
+
+        if (row * getItemHeight() < m_scroll->getValue())
+            m_scroll->setValue(row * getItemHeight());
+        else if ((row + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
+            m_scroll->setValue((row + 1) * getItemHeight() - m_scroll->getViewportSize());
 
         return true;
     }
@@ -208,6 +249,8 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 
@@ -215,11 +258,11 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -228,11 +271,11 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -241,6 +284,8 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         if (index >= m_items.size())
             return false;
 
@@ -259,8 +304,17 @@ namespace tgui
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        m_itemIndexOutdated = true;
+
+        if (!m_itemFilter.isEmpty())
+        {
+            const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            const auto nextIt = ((it != m_filteredItems.end()) && (*it == index)) ? m_filteredItems.erase(it) : it;
+            for (auto laterIt = nextIt; laterIt != m_filteredItems.end(); ++laterIt)
+                --(*laterIt);
+        }
 
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         setPosition(m_position);
 
         return true;
@@ -270,6 +324,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidate();
+
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
@@ -277,6 +333,10 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_filteredItems.clear();
+        m_itemIndexByText.clear();
+        m_itemIndexById.clear();
+        m_itemIndexOutdated = false;
 
         m_scroll->setMaximum(0);
     }
@@ -285,11 +345,9 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return m_items[index].getString();
 
         return "";
     }
@@ -329,11 +387,11 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        invalidate();
+
+        const int index = findItemIndex(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -342,11 +400,11 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        invalidate();
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -355,10 +413,44 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         if (index >= m_items.size())
             return false;
 
         m_items[index].setString(newValue);
+        m_itemIndexOutdated = true;
+
+        // The item may have to be shown or hidden now
+        std::size_t row = index;
+        if (!m_itemFilter.isEmpty())
+        {
+            const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), index);
+            const bool wasShown = (it != m_filteredItems.end()) && (*it == index);
+            const bool shown = itemPassesFilter(newValue);
+            if (wasShown != shown)
+            {
+                if (shown)
+                    m_filteredItems.insert(it, index);
+                else
+                    m_filteredItems.erase(it);
+
+                updateHoveringItem(-1);
+                m_scroll->setMaximum(static_cast<unsigned int>(m_filteredItems.size() * m_itemHeight));
+
+                // The items below the changed item are now shown on a different row
+                setPosition(m_position);
+                return true;
+            }
+
+            if (!shown)
+                return true;
+
+            row = static_cast<std::size_t>(it - m_filteredItems.begin());
+        }
+
+        // Only the changed item has to be centered again in its row
+        m_items[index].setPosition({0, (row * m_itemHeight) + ((m_itemHeight - m_items[index].getSize().y) / 2.0f)});
         return true;
     }
 
@@ -391,6 +483,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
@@ -401,7 +495,7 @@ namespace tgui
         }
 
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
         setPosition(m_position);
     }
 
@@ -416,6 +510,8 @@ namespace tgui
 
     void ListBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -433,6 +529,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_maxItems = maximumItems;
 
@@ -442,8 +540,11 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_itemIndexOutdated = true;
+
+            m_filteredItems.erase(std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), m_maxItems), m_filteredItems.end());
 
-            m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+            m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
             setPosition(m_position);
         }
     }
@@ -459,6 +560,8 @@ namespace tgui
 
     void ListBox::setAutoScroll(bool autoScroll)
     {
+        invalidate();
+
         m_autoScroll = autoScroll;
     }
 
@@ -473,20 +576,89 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItemIndex(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return findItemIndexById(id) >= 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemIndexingEnabled(bool enabled)
+    {
+        m_itemIndexingEnabled = enabled;
+        m_itemIndexByText.clear();
+        m_itemIndexById.clear();
+        m_itemIndexOutdated = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isItemIndexingEnabled() const
+    {
+        return m_itemIndexingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemFilter(const sf::String& filter)
+    {
+        invalidate();
+
+        // When the filter only became more restrictive, the items that were already hidden don't have to be checked again
+        const bool onlyRefined = !m_itemFilter.isEmpty() && (filter.find(m_itemFilter) != sf::String::InvalidPos);
+        m_itemFilter = filter;
+
+        if (m_itemFilter.isEmpty())
+            m_filteredItems.clear();
+        else if (onlyRefined)
+        {
+            m_filteredItems.erase(std::remove_if(m_filteredItems.begin(), m_filteredItems.end(),
+                                                 [this](std::size_t index){ return !itemPassesFilter(m_items[index].getString()); }),
+                                  m_filteredItems.end());
+        }
+        else
+        {
+            m_filteredItems.clear();
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (itemPassesFilter(m_items[i].getString()))
+                    m_filteredItems.push_back(i);
+            }
+        }
+
+        updateHoveringItem(-1);
+        m_scroll->setMaximum(static_cast<unsigned int>(getFilteredItemCount() * m_itemHeight));
+        setPosition(m_position);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ListBox::getItemFilter() const
+    {
+        return m_itemFilter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getFilteredItemCount() const
+    {
+        if (m_itemFilter.isEmpty())
+            return m_items.size();
+        else
+            return m_filteredItems.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListBox::setScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_scroll->setValue(value);
     }
 
@@ -529,9 +701,9 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getFilteredItemCount())))
+                    updateHoveringItem(getItemAtRow(static_cast<std::size_t>(hoveringRow)));
                 else
                     updateHoveringItem(-1);
 
@@ -585,6 +757,7 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const int oldHoveringItem = m_hoveringItem;
         updateHoveringItem(-1);
 
         // Check if the mouse event should go to the scrollbar
@@ -602,9 +775,9 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getFilteredItemCount())))
+                    updateHoveringItem(getItemAtRow(static_cast<std::size_t>(hoveringRow)));
                 else
                     updateHoveringItem(-1);
 
@@ -620,6 +793,10 @@ namespace tgui
                 }
             }
         }
+
+        // The scrollbar isn't added to a container, so the list box has to be redrawn when the scrollbar changed
+        if (m_scroll->wasInvalidatedWithoutParent() || (m_hoveringItem != oldHoveringItem))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -984,6 +1161,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    int ListBox::findItemIndex(const sf::String& item) const
+    {
+        if (m_itemIndexingEnabled)
+        {
+            updateItemIndex();
+            const auto it = m_itemIndexByText.find(toIndexKey(item));
+            return (it != m_itemIndexByText.end()) ? static_cast<int>(it->second) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (m_items[i].getString() == item)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIndexById(const sf::String& id) const
+    {
+        if (m_itemIndexingEnabled)
+        {
+            updateItemIndex();
+            const auto it = m_itemIndexById.find(toIndexKey(id));
+            return (it != m_itemIndexById.end()) ? static_cast<int>(it->second) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
+        {
+            if (m_itemIds[i] == id)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemIndex() const
+    {
+        if (!m_itemIndexOutdated)
+            return;
+
+        m_itemIndexByText.clear();
+        m_itemIndexById.clear();
+
+        // Emplace doesn't overwrite existing keys, so duplicates map to the first item like in a linear search
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            m_itemIndexByText.emplace(toIndexKey(m_items[i].getString()), i);
+            m_itemIndexById.emplace(toIndexKey(m_itemIds[i]), i);
+        }
+
+        m_itemIndexOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::itemPassesFilter(const sf::String& item) const
+    {
+        const auto toLowerAscii = [](std::uint32_t c){ return ((c >= 'A') && (c <= 'Z')) ? c - 'A' + 'a' : c; };
+        return std::search(item.begin(), item.end(), m_itemFilter.begin(), m_itemFilter.end(),
+                           [&](std::uint32_t left, std::uint32_t right){ return toLowerAscii(left) == toLowerAscii(right); }) != item.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getItemRow(int index) const
+    {
+        if ((index < 0) || m_itemFilter.isEmpty())
+            return index;
+
+        const auto it = std::lower_bound(m_filteredItems.begin(), m_filteredItems.end(), static_cast<std::size_t>(index));
+        if ((it == m_filteredItems.end()) || (*it != static_cast<std::size_t>(index)))
+            return -1;
+
+        return static_cast<int>(it - m_filteredItems.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getItemAtRow(std::size_t row) const
+    {
+        if (m_itemFilter.isEmpty())
+            return static_cast<int>(row);
+        else
+            return static_cast<int>(m_filteredItems[row]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1025,7 +1295,7 @@ namespace tgui
 
             // Find out which items are visible
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            std::size_t lastItem = getFilteredItemCount();
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1039,9 +1309,10 @@ namespace tgui
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = getItemRow(m_selectedItem);
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, selectedRow * static_cast<float>(m_itemHeight)});
 
                 const Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
                 if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
@@ -1049,21 +1320,22 @@ namespace tgui
                 else
                     drawRectangleShape(target, states, size, m_selectedBackgroundColorCached);
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -selectedRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveringRow = getItemRow(m_hoveringItem);
+            if ((hoveringRow >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, hoveringRow * static_cast<float>(m_itemHeight)});
                 drawRectangleShape(target, states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -hoveringRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            for (std::size_t row = firstItem; row < lastItem; ++row)
+                m_items[getItemAtRow(row)].draw(target, states);
         }
 
         // Draw the scrollbar
@@ -115,6 +115,8 @@ namespace tgui
 
     std::size_t ListView::addColumn(const sf::String& text, float width, ColumnAlignment alignment)
     {
+        invalidate();
+
         Column column;
         column.text = createHeaderText(text);
         column.alignment = alignment;
@@ -126,6 +128,7 @@ namespace tgui
 
         m_columns.push_back(std::move(column));
         updateHorizontalScrollbarMaximum();
+        updateVirtualItems(true);
 
         return m_columns.size()-1;
     }
@@ -134,6 +137,8 @@ namespace tgui
 
     void ListView::setColumnText(std::size_t index, const sf::String& text)
     {
+        invalidate();
+
         if (index >= m_columns.size())
         {
             TGUI_PRINT_WARNING("setColumnText called with invalid index.");
@@ -164,6 +169,8 @@ namespace tgui
 
     void ListView::setColumnWidth(std::size_t index, float width)
     {
+        invalidate();
+
         if (index >= m_columns.size())
         {
             TGUI_PRINT_WARNING("setColumnWidth called with invalid index.");
@@ -196,8 +203,11 @@ namespace tgui
 
     void ListView::removeAllColumns()
     {
+        invalidate();
+
         m_columns.clear();
         updateHorizontalScrollbarMaximum();
+        updateVirtualItems(true);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +221,8 @@ namespace tgui
 
     void ListView::setHeaderHeight(float height)
     {
+        invalidate();
+
         m_requestedHeaderHeight = height;
         updateVerticalScrollbarMaximum();
     }
@@ -239,6 +251,8 @@ namespace tgui
 
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
+        invalidate();
+
         if (columnIndex < m_columns.size())
             m_columns[columnIndex].alignment = alignment;
         else
@@ -264,6 +278,8 @@ namespace tgui
 
     void ListView::setHeaderVisible(bool showHeader)
     {
+        invalidate();
+
         m_headerVisible = showHeader;
         updateVerticalScrollbarMaximum();
     }
@@ -279,6 +295,14 @@ namespace tgui
 
     std::size_t ListView::addItem(const sf::String& text)
     {
+        if (m_virtualCellGetter)
+        {
+            TGUI_PRINT_WARNING("addItem can't be used when the list view is in virtual mode.");
+            return m_virtualItemCount;
+        }
+
+        invalidate();
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
@@ -296,6 +320,14 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<sf::String>& itemTexts)
     {
+        if (m_virtualCellGetter)
+        {
+            TGUI_PRINT_WARNING("addItem can't be used when the list view is in virtual mode.");
+            return m_virtualItemCount;
+        }
+
+        invalidate();
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -316,6 +348,14 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<sf::String>>& items)
     {
+        if (m_virtualCellGetter)
+        {
+            TGUI_PRINT_WARNING("addMultipleItems can't be used when the list view is in virtual mode.");
+            return;
+        }
+
+        invalidate();
+
         for (unsigned int i = 0; i < items.size(); ++i)
         {
             TGUI_EMPLACE_BACK(item, m_items)
@@ -337,7 +377,9 @@ namespace tgui
 
     bool ListView::changeItem(std::size_t index, const std::vector<sf::String>& itemTexts)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (m_virtualCellGetter || (index >= m_items.size()))
             return false;
 
         Item& item = m_items[index];
@@ -353,7 +395,9 @@ namespace tgui
 
     bool ListView::changeSubItem(std::size_t index, std::size_t column, const sf::String& itemText)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (m_virtualCellGetter || (index >= m_items.size()))
             return false;
 
         Item& item = m_items[index];
@@ -368,6 +412,11 @@ namespace tgui
 
     bool ListView::removeItem(std::size_t index)
     {
+        if (m_virtualCellGetter)
+            return false;
+
+        invalidate();
+
         // Update the hovered item
         if (m_hoveredItem >= 0)
         {
@@ -440,10 +489,15 @@ namespace tgui
 
     void ListView::removeAllItems()
     {
+        invalidate();
+
         updateSelectedItem(-1);
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_virtualCellGetter = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItemsStart = 0;
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
@@ -453,9 +507,76 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setVirtualItems(std::size_t itemCount, std::function<sf::String(std::size_t, std::size_t)> cellGetter)
+    {
+        removeAllItems();
+
+        m_virtualCellGetter = std::move(cellGetter);
+        if (m_virtualCellGetter)
+            m_virtualItemCount = itemCount;
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVirtualItemCount(std::size_t itemCount)
+    {
+        if (!m_virtualCellGetter)
+        {
+            TGUI_PRINT_WARNING("setVirtualItemCount called while list view isn't in virtual mode.");
+            return;
+        }
+
+        invalidate();
+
+        if (m_hoveredItem >= static_cast<int>(itemCount))
+            updateHoveredItem(-1);
+
+        if (!m_selectedItems.empty() && (*m_selectedItems.rbegin() >= itemCount))
+        {
+            m_selectedItems.erase(m_selectedItems.lower_bound(itemCount), m_selectedItems.end());
+            if (!m_multiSelect)
+                onItemSelect.emit(this, -1);
+        }
+
+        // Forget the loaded items that no longer exist
+        if (m_virtualItemsStart + m_items.size() > itemCount)
+            m_items.resize((itemCount > m_virtualItemsStart) ? (itemCount - m_virtualItemsStart) : 0);
+
+        const bool itemsAdded = (itemCount > m_virtualItemCount);
+        m_virtualItemCount = itemCount;
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (itemsAdded && m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+        {
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+            updateVirtualItems();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::reloadVirtualItems()
+    {
+        updateVirtualItems(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isVirtual() const
+    {
+        return m_virtualCellGetter != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -468,12 +589,16 @@ namespace tgui
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
         else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        updateVirtualItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::setSelectedItems(const std::set<std::size_t>& indices)
     {
+        invalidate();
+
         if (!m_multiSelect)
         {
             updateSelectedItem(indices.empty() ? -1 : static_cast<int>(*indices.begin()));
@@ -497,6 +622,8 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     void ListView::deselectItem()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 #endif
@@ -504,6 +631,8 @@ namespace tgui
 
     void ListView::deselectItems()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 
@@ -521,6 +650,8 @@ namespace tgui
 
     void ListView::setMultiSelect(bool multiSelect)
     {
+        invalidate();
+
         m_multiSelect = multiSelect;
         if (!m_multiSelect && m_selectedItems.size() > 1)
             updateSelectedItem(static_cast<int>(*m_selectedItems.begin()));
@@ -544,6 +675,14 @@ namespace tgui
 
     void ListView::setItemIcon(std::size_t index, const Texture& texture)
     {
+        invalidate();
+
+        if (m_virtualCellGetter)
+        {
+            TGUI_PRINT_WARNING("setItemIcon can't be used when the list view is in virtual mode.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             TGUI_PRINT_WARNING("setItemIcon called with invalid index.");
@@ -585,8 +724,10 @@ namespace tgui
 
     Texture ListView::getItemIcon(std::size_t index) const
     {
-        if (index < m_items.size())
-            return m_items[index].icon.getTexture();
+        if (const Item* item = getLoadedItem(index))
+            return item->icon.getTexture();
+        else if (index < getItemCount())
+            return {};
         else
         {
             TGUI_PRINT_WARNING("getItemIcon called with invalid index.");
@@ -598,19 +739,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_virtualCellGetter)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_virtualCellGetter)
+            return m_virtualCellGetter(rowIndex, columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -621,6 +768,9 @@ namespace tgui
 
     sf::String ListView::getItem(std::size_t index) const
     {
+        if (m_virtualCellGetter)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -635,7 +785,15 @@ namespace tgui
     std::vector<sf::String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<sf::String> row;
-        if (index < m_items.size())
+        if (m_virtualCellGetter)
+        {
+            if (index < m_virtualItemCount)
+            {
+                for (std::size_t i = 0; i < std::max<std::size_t>(1, m_columns.size()); ++i)
+                    row.push_back(m_virtualCellGetter(index, i));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -649,7 +807,10 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const sf::String&, const sf::String&)>& cmp)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        // In virtual mode the items have to be sorted by whoever provides them
+        if (m_virtualCellGetter || (index >= m_items.size()))
             return;
 
         std::sort(m_items.begin(), m_items.end(),
@@ -671,9 +832,9 @@ namespace tgui
 
     std::vector<sf::String> ListView::getItems() const
     {
-        std::vector<sf::String> items(m_items.size());
+        std::vector<sf::String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -685,6 +846,15 @@ namespace tgui
     {
         std::vector<std::vector<sf::String>> rows;
 
+        if (m_virtualCellGetter)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<sf::String> row;
@@ -702,6 +872,8 @@ namespace tgui
 
     void ListView::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
@@ -728,6 +900,8 @@ namespace tgui
 
     void ListView::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -752,6 +926,8 @@ namespace tgui
 
     void ListView::setHeaderTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_headerTextSize = textSize;
 
         const unsigned int headerTextSize = getHeaderTextSize();
@@ -780,6 +956,8 @@ namespace tgui
 
     void ListView::setSeparatorWidth(unsigned int width)
     {
+        invalidate();
+
         m_separatorWidth = width;
         updateHorizontalScrollbarMaximum();
     }
@@ -795,6 +973,8 @@ namespace tgui
 
     void ListView::setHeaderSeparatorHeight(unsigned int height)
     {
+        invalidate();
+
         m_headerSeparatorHeight = height;
         updateVerticalScrollbarMaximum();
     }
@@ -810,6 +990,8 @@ namespace tgui
 
     void ListView::setGridLinesWidth(unsigned int width)
     {
+        invalidate();
+
         m_gridLinesWidth = width;
         updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -826,6 +1008,8 @@ namespace tgui
 
     void ListView::setAutoScroll(bool autoScroll)
     {
+        invalidate();
+
         m_autoScroll = autoScroll;
     }
 
@@ -840,6 +1024,8 @@ namespace tgui
 
     void ListView::setShowVerticalGridLines(bool showGridLines)
     {
+        invalidate();
+
         m_showVerticalGridLines = showGridLines;
         updateHorizontalScrollbarMaximum();
     }
@@ -855,6 +1041,8 @@ namespace tgui
 
     void ListView::setShowHorizontalGridLines(bool showGridLines)
     {
+        invalidate();
+
         m_showHorizontalGridLines = showGridLines;
         updateVerticalScrollbarMaximum();
     }
@@ -870,6 +1058,8 @@ namespace tgui
 
     void ListView::setExpandLastColumn(bool expand)
     {
+        invalidate();
+
         m_expandLastColumn = expand;
     }
 
@@ -884,6 +1074,8 @@ namespace tgui
 
     void ListView::setVerticalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_verticalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -915,6 +1107,8 @@ namespace tgui
 
     void ListView::setHorizontalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_horizontalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -946,7 +1140,10 @@ namespace tgui
 
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_verticalScrollbar->setValue(value);
+        updateVirtualItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -960,6 +1157,8 @@ namespace tgui
 
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -987,6 +1186,7 @@ namespace tgui
         if (m_verticalScrollbar->mouseOnWidget(pos))
         {
             m_verticalScrollbar->leftMousePressed(pos);
+            updateVirtualItems();
         }
         else if (m_horizontalScrollbar->isShown() && m_horizontalScrollbar->mouseOnWidget(pos))
         {
@@ -1115,6 +1315,7 @@ namespace tgui
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->mouseOnWidget(pos))
         {
             m_verticalScrollbar->mouseMoved(pos);
+            updateVirtualItems();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->mouseOnWidget(pos))
         {
@@ -1172,6 +1373,12 @@ namespace tgui
                 }
             }
         }
+
+        // The scrollbars aren't added to a container, so the list view has to be redrawn when a scrollbar changed
+        const bool verticalScrollbarChanged = m_verticalScrollbar->wasInvalidatedWithoutParent();
+        const bool horizontalScrollbarChanged = m_horizontalScrollbar->wasInvalidatedWithoutParent();
+        if (verticalScrollbarChanged || horizontalScrollbarChanged || (m_hoveredItem != oldHoveredItem))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1191,6 +1398,7 @@ namespace tgui
         else if (m_verticalScrollbar->isShown())
         {
             m_verticalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
+            updateVirtualItems();
             mouseMoved(pos); // Update on which item the mouse is hovered
             return true;
         }
@@ -1414,22 +1622,26 @@ namespace tgui
             node->children.push_back(std::move(columnNode));
         }
 
-        for (const auto& item : m_items)
+        // In virtual mode the items are provided by the application and aren't saved
+        if (!m_virtualCellGetter)
         {
-            auto itemNode = std::make_unique<DataIO::Node>();
-            itemNode->name = "Item";
-
-            if (!item.texts.empty())
+            for (const auto& item : m_items)
             {
-                std::string textsList = "[" + Serializer::serialize(item.texts[0].getString());
-                for (std::size_t i = 1; i < item.texts.size(); ++i)
-                    textsList += ", " + Serializer::serialize(item.texts[i].getString());
-                textsList += "]";
+                auto itemNode = std::make_unique<DataIO::Node>();
+                itemNode->name = "Item";
 
-                itemNode->propertyValuePairs["Texts"] = std::make_unique<DataIO::ValueNode>(textsList);
-            }
+                if (!item.texts.empty())
+                {
+                    std::string textsList = "[" + Serializer::serialize(item.texts[0].getString());
+                    for (std::size_t i = 1; i < item.texts.size(); ++i)
+                        textsList += ", " + Serializer::serialize(item.texts[i].getString());
+                    textsList += "]";
+
+                    itemNode->propertyValuePairs["Texts"] = std::make_unique<DataIO::ValueNode>(textsList);
+                }
 
-            node->children.push_back(std::move(itemNode));
+                node->children.push_back(std::move(itemNode));
+            }
         }
 
         if (!m_autoScroll)
@@ -1650,7 +1862,13 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
-        for (auto& text : m_items[index].texts)
+        invalidate();
+
+        // Items that aren't loaded in virtual mode get their color when they are loaded
+        if ((index < m_virtualItemsStart) || (index - m_virtualItemsStart >= m_items.size()))
+            return;
+
+        for (auto& text : m_items[index - m_virtualItemsStart].texts)
             text.setColor(color);
     }
 
@@ -1685,7 +1903,7 @@ namespace tgui
     void ListView::updateItemColors()
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
-            setItemColor(i, m_textColorCached);
+            setItemColor(m_virtualItemsStart + i, m_textColorCached);
 
         updateSelectedAndhoveredItemColors();
     }
@@ -1758,6 +1976,8 @@ namespace tgui
 
     void ListView::addSelectedItem(int item)
     {
+        invalidate();
+
         if (!m_multiSelect)
         {
             updateSelectedItem(item);
@@ -1784,6 +2004,8 @@ namespace tgui
 
     void ListView::removeSelectedItem(std::size_t item)
     {
+        invalidate();
+
         m_selectedItems.erase(item);
         if ((static_cast<int>(item) == m_hoveredItem) && m_textColorHoverCached.isSet())
             setItemColor(item, m_textColorHoverCached);
@@ -1803,7 +2025,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -1887,6 +2109,8 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom if it changes due to a different viewport size
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        updateVirtualItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1895,9 +2119,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1905,6 +2130,8 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        updateVirtualItems();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1934,6 +2161,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::updateVirtualItems(bool reloadAll)
+    {
+        if (!m_virtualCellGetter)
+            return;
+
+        // Find out which items are visible and also load a few items around them, so that not every scroll requires loading items
+        const std::size_t overscanItemCount = 8;
+        const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
+        std::size_t firstItem = 0;
+        std::size_t lastItem = m_virtualItemCount;
+        if (totalItemHeight > 0)
+        {
+            firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
+            lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
+        }
+
+        lastItem = std::min(lastItem + overscanItemCount, m_virtualItemCount);
+        firstItem = std::min((firstItem > overscanItemCount) ? (firstItem - overscanItemCount) : 0, lastItem);
+
+        if (!reloadAll && (firstItem == m_virtualItemsStart) && (lastItem == m_virtualItemsStart + m_items.size()))
+            return;
+
+        invalidate();
+
+        // Reuse the items that were already loaded and only ask for the contents of the new items
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        std::vector<Item> items;
+        items.reserve(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if (!reloadAll && (i >= m_virtualItemsStart) && (i - m_virtualItemsStart < m_items.size()))
+            {
+                items.push_back(std::move(m_items[i - m_virtualItemsStart]));
+                continue;
+            }
+
+            Item item;
+            item.texts.reserve(columnCount);
+            for (std::size_t column = 0; column < columnCount; ++column)
+                item.texts.push_back(createText(m_virtualCellGetter(i, column)));
+
+            item.icon.setOpacity(m_opacityCached);
+            items.push_back(std::move(item));
+        }
+
+        m_items = std::move(items);
+        m_virtualItemsStart = firstItem;
+
+        // The new items may need the colors of selected or hovered items
+        updateSelectedAndhoveredItemColors();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::Item* ListView::getLoadedItem(std::size_t index) const
+    {
+        if ((index < m_virtualItemsStart) || (index - m_virtualItemsStart >= m_items.size()))
+            return nullptr;
+
+        return &m_items[index - m_virtualItemsStart];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::drawHeaderText(sf::RenderTarget& target, sf::RenderStates states, float columnWidth, float headerHeight, std::size_t column) const
     {
         if (column >= m_columns.size())
@@ -1980,16 +2271,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item* item = getLoadedItem(i);
+                if (!item || !item->icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item->icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                m_items[i].icon.draw(target, states);
+                item->icon.draw(target, states);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2005,7 +2297,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item* item = getLoadedItem(i);
+            if (!item || (column >= item->texts.size()))
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2015,12 +2308,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item->texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item->texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            item->texts[column].draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
@@ -2058,14 +2351,15 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -2110,7 +2404,7 @@ namespace tgui
             const Clipping clipping{target, states, {}, {availableWidth, innerHeight - totalHeaderHeight}};
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 sf::Transform transformBeforeGridLines = states.transform;
 
@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +271,8 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
+
         createMenu(m_menus, text);
     }
 
@@ -277,6 +280,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& text)
     {
+        invalidate();
+
         if (!m_menus.empty())
             return addMenuItem(m_menus.back().text.getString(), text);
         else
@@ -287,6 +292,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         return addMenuItem({menu, text}, false);
     }
 
@@ -294,6 +301,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const std::vector<sf::String>& hierarchy, bool createParents)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -309,6 +318,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
+
         m_menus.clear();
     }
 
@@ -316,6 +327,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             if (m_menus[i].text.getString() != menu)
@@ -338,6 +351,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         return removeMenuItem({menu, menuItem}, false);
     }
 
@@ -345,6 +360,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -355,6 +372,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItems(const sf::String& menu)
     {
+        invalidate();
+
         return removeSubMenuItems(std::vector<sf::String>{menu});
     }
 
@@ -362,6 +381,8 @@ namespace tgui
 
     bool MenuBar::removeSubMenuItems(const std::vector<sf::String>& hierarchy)
     {
+        invalidate();
+
         if (hierarchy.empty())
             return false;
 
@@ -372,6 +393,8 @@ namespace tgui
 
     bool MenuBar::setMenuEnabled(const sf::String& menu, bool enabled)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             if (m_menus[i].text.getString() != menu)
@@ -405,6 +428,8 @@ namespace tgui
 
     bool MenuBar::setMenuItemEnabled(const sf::String& menuText, const sf::String& menuItemText, bool enabled)
     {
+        invalidate();
+
         return setMenuItemEnabled({menuText, menuItemText}, enabled);
     }
 
@@ -412,6 +437,8 @@ namespace tgui
 
     bool MenuBar::setMenuItemEnabled(const std::vector<sf::String>& hierarchy, bool enabled)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -461,6 +488,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         setTextSizeImpl(m_menus, size);
     }
@@ -469,6 +498,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumSubMenuWidth = minimumWidth;
     }
 
@@ -483,6 +514,8 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        invalidate();
+
         m_invertedMenuDirection = invertDirection;
     }
 
@@ -569,6 +602,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool MenuBar::isDrawnWithinBounds() const
+    {
+        return m_visibleMenu < 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MenuBar::isMouseOnWidgetWithinBounds() const
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::leftMousePressed(Vector2f pos)
     {
         // Check if a menu should be opened or closed
@@ -686,12 +733,14 @@ namespace tgui
                     {
                         updateMenuTextColor(m_menus[i].menuItems[m_menus[m_visibleMenu].selectedMenuItem], false);
                         m_menus[m_visibleMenu].selectedMenuItem = -1;
+                        invalidate();
                     }
                 }
                 else // The menu isn't open yet
                 {
                     // If there is another menu open then close it first
                     closeMenu();
+                    invalidate();
 
                     // If this menu can be opened then do so
                     if (m_menus[i].enabled && !m_menus[i].menuItems.empty())
@@ -737,6 +786,8 @@ namespace tgui
                 auto& menu = *menuBelowMouse;
                 if (menuItemIndexBelowMouse != menu.selectedMenuItem)
                 {
+                    invalidate();
+
                     // If another of the menu items is selected then unselect it
                     if (menu.selectedMenuItem != -1)
                         closeSubMenus(menu.menuItems, menu.selectedMenuItem);
@@ -752,7 +803,10 @@ namespace tgui
                 {
                     // If the selected item has a submenu then unselect its item
                     if (menu.menuItems[menuItemIndexBelowMouse].selectedMenuItem != -1)
+                    {
                         closeSubMenus(menu.menuItems[menuItemIndexBelowMouse].menuItems, menu.menuItems[menuItemIndexBelowMouse].selectedMenuItem);
+                        invalidate();
+                    }
                 }
             }
         }
@@ -1096,6 +1150,7 @@ namespace tgui
             if (menuItem.menuItems.empty())
             {
                 closeSubMenus(menu->menuItems, menu->selectedMenuItem);
+                invalidate();
                 break;
             }
 
@@ -1371,7 +1426,7 @@ namespace tgui
                 else
                     arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
 
-                target.draw(arrow, states);
+                RenderBatch::drawDrawable(target, arrow, states);
                 states.transform = textTransform;
             }
 
@@ -174,6 +174,8 @@ namespace tgui
 
     void MessageBox::setText(const sf::String& text)
     {
+        invalidate();
+
         m_label->setText(text);
 
         rearrange();
@@ -190,6 +192,8 @@ namespace tgui
 
     void MessageBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
 
         m_label->setTextSize(size);
@@ -204,6 +208,8 @@ namespace tgui
 
     void MessageBox::addButton(const sf::String& caption)
     {
+        invalidate();
+
         auto button = Button::create(caption);
         button->setRenderer(getSharedRenderer()->getButton());
         button->setTextSize(m_textSize);
@@ -113,6 +113,8 @@ namespace tgui
 
     void ProgressBar::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -139,6 +141,8 @@ namespace tgui
 
     void ProgressBar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_maximum = maximum;
 
@@ -165,6 +169,8 @@ namespace tgui
 
     void ProgressBar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is below the minimum or above the maximum then adjust it
         if (value < m_minimum)
             value = m_minimum;
@@ -208,6 +214,8 @@ namespace tgui
 
     void ProgressBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_textBack.setString(text);
         m_textFront.setString(text);
@@ -247,6 +255,8 @@ namespace tgui
 
     void ProgressBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
         setText(getText());
@@ -263,6 +273,8 @@ namespace tgui
 
     void ProgressBar::setFillDirection(FillDirection direction)
     {
+        invalidate();
+
         m_fillDirection = direction;
         recalculateFillSize();
     }
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
@@ -128,6 +129,8 @@ namespace tgui
 
     void RadioButton::setChecked(bool checked)
     {
+        invalidate();
+
         if (m_checked == checked)
             return;
 
@@ -159,6 +162,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_text.setString(text);
 
@@ -180,6 +185,8 @@ namespace tgui
 
     void RadioButton::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         setText(getText());
     }
@@ -195,6 +202,8 @@ namespace tgui
 
     void RadioButton::setTextClickable(bool acceptTextClick)
     {
+        invalidate();
+
         m_allowTextClick = acceptTextClick;
     }
 
@@ -663,7 +672,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            RenderBatch::drawDrawable(target, circle, states);
         }
 
         // Draw the box
@@ -697,7 +706,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            RenderBatch::drawDrawable(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -705,7 +714,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                RenderBatch::drawDrawable(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
@@ -197,6 +197,8 @@ namespace tgui
 
     void RangeSlider::setMinimum(float minimum)
     {
+        invalidate();
+
         const auto oldMinimum = m_minimum;
 
         // Set the new minimum
@@ -226,6 +228,8 @@ namespace tgui
 
     void RangeSlider::setMaximum(float maximum)
     {
+        invalidate();
+
         const auto oldMaximum = m_maximum;
 
         // Set the new maximum
@@ -255,6 +259,8 @@ namespace tgui
 
     void RangeSlider::setSelectionStart(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -290,6 +296,8 @@ namespace tgui
 
     void RangeSlider::setSelectionEnd(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -325,6 +333,8 @@ namespace tgui
 
     void RangeSlider::setStep(float step)
     {
+        invalidate();
+
         m_step = step;
 
         // Reset the values in case it does not match the step
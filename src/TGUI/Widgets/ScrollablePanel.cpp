@@ -206,6 +206,8 @@ namespace tgui
 
     void ScrollablePanel::add(const Widget::Ptr& widget, const sf::String& widgetName)
     {
+        invalidate();
+
         Panel::add(widget, widgetName);
 
         if (m_contentSize == Vector2f{0, 0})
@@ -226,6 +228,8 @@ namespace tgui
 
     bool ScrollablePanel::remove(const Widget::Ptr& widget)
     {
+        invalidate();
+
         const auto callbackIt = m_connectedCallbacks.find(widget);
         if (callbackIt != m_connectedCallbacks.end())
         {
@@ -253,6 +257,8 @@ namespace tgui
 
     void ScrollablePanel::removeAllWidgets()
     {
+        invalidate();
+
         disconnectAllChildWidgets();
 
         Panel::removeAllWidgets();
@@ -268,6 +274,8 @@ namespace tgui
 
     void ScrollablePanel::setContentSize(Vector2f size)
     {
+        invalidate();
+
         m_contentSize = size;
 
         disconnectAllChildWidgets();
@@ -307,6 +315,8 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     void ScrollablePanel::setScrollbarWidth(float width)
     {
+        invalidate();
+
         m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
         m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
         updateScrollbars();
@@ -323,6 +333,8 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_verticalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -354,6 +366,8 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_horizontalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -385,6 +399,8 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollAmount(unsigned int scrollAmount)
     {
+        invalidate();
+
         m_verticalScrollAmount = scrollAmount;
 
         if (scrollAmount == 0)
@@ -407,6 +423,8 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollAmount(unsigned int scrollAmount)
     {
+        invalidate();
+
         m_horizontalScrollAmount = scrollAmount;
 
         if (scrollAmount == 0)
@@ -429,6 +447,8 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_verticalScrollbar->setValue(value);
     }
 
@@ -443,6 +463,8 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -509,6 +531,12 @@ namespace tgui
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
+
+        // The scrollbars aren't child widgets, so the panel has to be redrawn when a scrollbar changed
+        const bool verticalScrollbarChanged = m_verticalScrollbar->wasInvalidatedWithoutParent();
+        const bool horizontalScrollbarChanged = m_horizontalScrollbar->wasInvalidatedWithoutParent();
+        if (verticalScrollbarChanged || horizontalScrollbarChanged)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +105,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_maximum = maximum;
@@ -131,6 +134,8 @@ namespace tgui
 
     void Scrollbar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is above the maximum then adjust it
         if (m_maximum < m_viewportSize)
             value = 0;
@@ -159,6 +164,8 @@ namespace tgui
 
     void Scrollbar::setViewportSize(unsigned int viewportSize)
     {
+        invalidate();
+
         // Set the new value
         m_viewportSize = viewportSize;
 
@@ -183,6 +190,8 @@ namespace tgui
 
     void Scrollbar::setScrollAmount(unsigned int scrollAmount)
     {
+        invalidate();
+
         m_scrollAmount = scrollAmount;
     }
 
@@ -197,6 +206,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
+
         m_autoHide = autoHide;
     }
 
@@ -211,6 +222,8 @@ namespace tgui
 
     void Scrollbar::setVerticalScroll(bool vertical)
     {
+        invalidate();
+
         if (m_verticalScroll == vertical)
             return;
 
@@ -428,6 +441,9 @@ namespace tgui
             if (!m_autoHide && (m_maximum <= m_viewportSize))
                 return;
 
+            // The thumb follows the mouse, even when the value doesn't change
+            invalidate();
+
             // Check in which direction the scrollbar lies
             if (m_verticalScroll)
             {
@@ -577,6 +593,7 @@ namespace tgui
             }
         }
 
+        const Part oldHoverPart = m_mouseHoverOverPart;
         if (FloatRect{m_thumb.left, m_thumb.top, m_thumb.width, m_thumb.height}.contains(pos))
             m_mouseHoverOverPart = Part::Thumb;
         else if (FloatRect{m_track.left, m_track.top, m_track.width, m_track.height}.contains(pos))
@@ -585,6 +602,9 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        if (m_mouseHoverOverPart != oldHoverPart)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -982,7 +1002,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            RenderBatch::drawDrawable(target, arrow, states);
         }
 
         // Draw the track
@@ -1056,7 +1076,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            RenderBatch::drawDrawable(target, arrow, states);
         }
     }
 
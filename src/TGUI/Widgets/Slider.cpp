@@ -194,6 +194,8 @@ namespace tgui
 
     void Slider::setMinimum(float minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -219,6 +221,8 @@ namespace tgui
 
     void Slider::setMaximum(float maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_maximum = maximum;
 
@@ -244,6 +248,8 @@ namespace tgui
 
     void Slider::setValue(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -275,6 +281,8 @@ namespace tgui
 
     void Slider::setStep(float step)
     {
+        invalidate();
+
         m_step = step;
 
         // Reset the value in case it does not match the step
@@ -292,6 +300,8 @@ namespace tgui
 
     void Slider::setVerticalScroll(bool vertical)
     {
+        invalidate();
+
         if (m_verticalScroll == vertical)
             return;
 
@@ -310,6 +320,8 @@ namespace tgui
 
     void Slider::setInvertedDirection(bool invertedDirection)
     {
+        invalidate();
+
         m_invertedDirection = invertedDirection;
         updateThumbPosition();
     }
@@ -325,6 +337,8 @@ namespace tgui
 
     void Slider::setChangeValueOnScroll(bool changeValueOnScroll)
     {
+        invalidate();
+
         m_changeValueOnScroll = changeValueOnScroll;
     }
 
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -132,6 +133,8 @@ namespace tgui
 
     void SpinButton::setMinimum(float minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -155,6 +158,8 @@ namespace tgui
 
     void SpinButton::setMaximum(float maximum)
     {
+        invalidate();
+
         m_maximum = maximum;
 
         // The maximum can never be below the minimum
@@ -177,6 +182,8 @@ namespace tgui
 
     void SpinButton::setValue(float value)
     {
+        invalidate();
+
         // Round to nearest allowed value
         if (m_step != 0)
            value = m_minimum + (std::round((value - m_minimum) / m_step) * m_step);
@@ -205,6 +212,8 @@ namespace tgui
 
     void SpinButton::setStep(float step)
     {
+        invalidate();
+
         m_step = step;
     }
 
@@ -219,6 +228,8 @@ namespace tgui
 
     void SpinButton::setVerticalScroll(bool vertical)
     {
+        invalidate();
+
         if (m_verticalScroll == vertical)
             return;
 
@@ -303,6 +314,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(Vector2f pos)
     {
+        const bool wasHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -319,6 +332,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != wasHoverOnTopArrow)
+            invalidate();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -491,8 +507,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            RenderBatch::drawDrawable(target, arrowBack, states);
+            RenderBatch::drawDrawable(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -557,8 +573,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            RenderBatch::drawDrawable(target, arrowBack, states);
+            RenderBatch::drawDrawable(target, arrow, states);
         }
     }
 
@@ -116,6 +116,8 @@ namespace tgui
 
     void Tabs::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -134,6 +136,8 @@ namespace tgui
 
     std::size_t Tabs::add(const sf::String& text, bool selectTab)
     {
+        invalidate();
+
         // Use the insert function to put the tab in the right place
         insert(m_tabs.size(), text, selectTab);
 
@@ -145,6 +149,8 @@ namespace tgui
 
     void Tabs::insert(std::size_t index, const sf::String& text, bool selectTab)
     {
+        invalidate();
+
         // If the index is too high then just insert at the end
         if (index > m_tabs.size())
             index = m_tabs.size();
@@ -188,6 +194,8 @@ namespace tgui
 
     bool Tabs::changeText(std::size_t index, const sf::String& text)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return false;
 
@@ -200,6 +208,8 @@ namespace tgui
 
     bool Tabs::select(const sf::String& text)
     {
+        invalidate();
+
         for (unsigned int i = 0; i < m_tabs.size(); ++i)
         {
             if (m_tabs[i].text.getString() == text)
@@ -214,6 +224,8 @@ namespace tgui
 
     bool Tabs::select(std::size_t index)
     {
+        invalidate();
+
         // Don't select a tab that is already selected
         if (m_selectedTab == static_cast<int>(index))
             return true;
@@ -241,6 +253,8 @@ namespace tgui
 
     void Tabs::deselect()
     {
+        invalidate();
+
         if (m_selectedTab >= 0)
         {
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
@@ -252,6 +266,8 @@ namespace tgui
 
     bool Tabs::remove(const sf::String& text)
     {
+        invalidate();
+
         for (unsigned int i = 0; i < m_tabs.size(); ++i)
         {
             if (m_tabs[i].text.getString() == text)
@@ -265,6 +281,8 @@ namespace tgui
 
     bool Tabs::remove(std::size_t index)
     {
+        invalidate();
+
         // The index can't be too high
         if (index > m_tabs.size() - 1)
             return false;
@@ -287,6 +305,8 @@ namespace tgui
 
     void Tabs::removeAll()
     {
+        invalidate();
+
         m_tabs.clear();
         m_selectedTab = -1;
         m_hoveringTab = -1;
@@ -315,6 +335,8 @@ namespace tgui
 
     void Tabs::setTabVisible(std::size_t index, bool visible)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return;
 
@@ -336,6 +358,8 @@ namespace tgui
 
     void Tabs::setTabEnabled(std::size_t index, bool enabled)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return;
 
@@ -357,6 +381,8 @@ namespace tgui
 
     void Tabs::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if ((size == 0) || (m_requestedTextSize != size))
         {
             m_requestedTextSize = size;
@@ -377,6 +403,8 @@ namespace tgui
 
     void Tabs::setTabHeight(float height)
     {
+        invalidate();
+
         Widget::setSize({getSizeLayout().x, height});
         m_bordersCached.updateParentSize(getSize());
 
@@ -389,6 +417,8 @@ namespace tgui
 
     void Tabs::setMaximumTabWidth(float maximumWidth)
     {
+        invalidate();
+
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
@@ -405,6 +435,8 @@ namespace tgui
 
     void Tabs::setMinimumTabWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
@@ -462,6 +494,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -482,6 +515,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,7 +526,11 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
 
-        m_hoveringTab = -1;
+        if (m_hoveringTab != -1)
+        {
+            m_hoveringTab = -1;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
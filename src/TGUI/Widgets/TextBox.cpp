@@ -28,6 +28,8 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,11 +131,15 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Remove all the excess characters when a character limit is set
-        if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
-            m_text = text.substring(0, m_maxChars);
-        else
-            m_text = text;
+        const sf::String newText = ((m_maxChars > 0) && (text.getSize() > m_maxChars)) ? text.substring(0, m_maxChars) : text;
+        if (newText != m_text)
+        {
+            markTextChanged(0, m_text.getSize());
+            m_text = newText;
+        }
 
         rearrangeText(false);
     }
@@ -142,7 +148,17 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        invalidate();
+
+        // Only add the characters that still fit when a character limit is set
+        std::size_t length = text.getSize();
+        if (m_maxChars > 0)
+            length = std::min(length, m_maxChars - std::min(m_maxChars, m_text.getSize()));
+
+        markTextChanged(m_text.getSize(), 0);
+        m_text += text.substring(0, length);
+
+        rearrangeText(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +172,8 @@ namespace tgui
 
     void TextBox::setDefaultText(const sf::String& text)
     {
+        invalidate();
+
         m_defaultText.setString(text);
     }
 
@@ -170,6 +188,8 @@ namespace tgui
 
     void TextBox::setSelectedText(std::size_t selectionStartIndex, std::size_t selectionEndIndex)
     {
+        invalidate();
+
         setCaretPosition(selectionEndIndex);
         sf::Vector2<std::size_t> selEnd = m_selEnd;
         setCaretPosition(selectionStartIndex);
@@ -207,6 +227,8 @@ namespace tgui
 
     void TextBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_textSize = size;
         if (m_textSize < 1)
@@ -233,6 +255,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(std::size_t maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -240,6 +264,7 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
         {
             // Remove all the excess characters
+            markTextChanged(m_maxChars, m_text.getSize() - m_maxChars);
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             rearrangeText(false);
         }
@@ -256,6 +281,8 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     void TextBox::setHorizontalScrollbarPresent(bool present)
     {
+        invalidate();
+
         setHorizontalScrollbarPolicy(present ? Scrollbar::Policy::Automatic : Scrollbar::Policy::Never);
     }
 
@@ -270,6 +297,8 @@ namespace tgui
 
     void TextBox::setVerticalScrollbarPresent(bool present)
     {
+        invalidate();
+
         setVerticalScrollbarPolicy(present ? Scrollbar::Policy::Automatic : Scrollbar::Policy::Never);
     }
 
@@ -285,6 +314,8 @@ namespace tgui
 
     void TextBox::setVerticalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_verticalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -316,6 +347,8 @@ namespace tgui
 
     void TextBox::setHorizontalScrollbarPolicy(Scrollbar::Policy policy)
     {
+        invalidate();
+
         m_horizontalScrollbarPolicy = policy;
 
         if (policy == Scrollbar::Policy::Always)
@@ -347,6 +380,8 @@ namespace tgui
 
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
@@ -384,6 +419,8 @@ namespace tgui
 
     void TextBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -438,7 +475,10 @@ namespace tgui
 
     void TextBox::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +492,8 @@ namespace tgui
 
     void TextBox::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -640,6 +682,12 @@ namespace tgui
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
+
+        // The scrollbars aren't added to a container, so the text box has to be redrawn when a scrollbar changed
+        const bool verticalScrollbarChanged = m_verticalScrollbar->wasInvalidatedWithoutParent();
+        const bool horizontalScrollbarChanged = m_horizontalScrollbar->wasInvalidatedWithoutParent();
+        if (verticalScrollbarChanged || horizontalScrollbarChanged)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -976,6 +1024,7 @@ namespace tgui
 
                         m_selStart = m_selEnd;
 
+                        markTextChanged(pos - 1, 1);
                         m_text.erase(pos - 1, 1);
                         rearrangeText(true);
                     }
@@ -999,6 +1048,7 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
+                    markTextChanged(getSelectionEnd(), 1);
                     m_text.erase(getSelectionEnd(), 1);
                     rearrangeText(true);
                 }
@@ -1062,6 +1112,7 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
+                        markTextChanged(getSelectionEnd(), 0);
                         m_text.insert(getSelectionEnd(), clipboardContents);
                         m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
 
@@ -1102,6 +1153,7 @@ namespace tgui
 
             const std::size_t caretPosition = getSelectionEnd();
 
+            markTextChanged(caretPosition, 0);
             m_text.insert(caretPosition, key);
             m_lines[m_selEnd.y].insert(m_selEnd.x, key);
 
@@ -1133,6 +1185,7 @@ namespace tgui
             // Undo the insert if the text does not fit
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
+                markTextChanged(0, m_text.getSize());
                 m_text = oldText;
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
@@ -1213,9 +1266,9 @@ namespace tgui
             //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, getTextSize(), false);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
             if (width + charWidth + kerning <= position.x)
@@ -1272,11 +1325,13 @@ namespace tgui
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
             {
+                markTextChanged(selStart, selEnd - selStart);
                 m_text.erase(selStart, selEnd - selStart);
                 m_selEnd = m_selStart;
             }
             else
             {
+                markTextChanged(selEnd, selStart - selEnd);
                 m_text.erase(selEnd, selStart - selEnd);
                 m_selStart = m_selEnd;
             }
@@ -1287,28 +1342,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::markTextChanged(std::size_t pos, std::size_t removedLength)
+    {
+        // Erasing past the end of the text doesn't remove anything
+        removedLength = std::min(removedLength, m_text.getSize() - pos);
+
+        // Characters behind the changed part keep their distance from the end of the text
+        const std::size_t unchangedEnd = m_text.getSize() - pos - removedLength;
+        if (m_textChanged)
+        {
+            m_unchangedTextStart = std::min(m_unchangedTextStart, pos);
+            m_unchangedTextEnd = std::min(m_unchangedTextEnd, unchangedEnd);
+        }
+        else
+        {
+            m_unchangedTextStart = pos;
+            m_unchangedTextEnd = unchangedEnd;
+            m_textChanged = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::rearrangeText(bool keepSelection)
     {
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        sf::String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
             // Find the maximum width of one line
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
             if (m_verticalScrollbar->isShown())
                 maxLineWidth -= m_verticalScrollbar->getSize().x;
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
         }
 
         // Store the current selection position when we are keeping the selection
@@ -1316,45 +1389,30 @@ namespace tgui
         const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
 
         // Split the string in multiple lines
+        updateLines(maxLineWidth);
+
         m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
-
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            // Without word-wrap, every paragraph is a single line
+            if (m_monospacedFontOptimizationEnabled)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().getSize() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().getSize();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                std::size_t longestLineIndex = 0;
+                for (std::size_t i = 1; i < m_lines.size(); ++i)
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSize);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    if (m_lines[i].getSize() > m_lines[longestLineIndex].getSize())
+                        longestLineIndex = i;
                 }
-            }
 
-            searchPosStart = newLinePos + 1;
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+            }
+            else // Not using optimization for monospaced font, so really calculate the width of every line
+            {
+                for (const auto& paragraph : m_paragraphs)
+                    m_maxLineWidth = std::max(m_maxLineWidth, paragraph.width);
+            }
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
-
         // Check if we should try to keep our selection
         if (keepSelection)
         {
@@ -1445,6 +1503,122 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateLines(float maxLineWidth)
+    {
+        const bool calculateWidths = (maxLineWidth == 0) && !m_monospacedFontOptimizationEnabled;
+
+        // The old lines can only be reused when they were created in the same way
+        if ((maxLineWidth != m_wrappedTextMaxWidth) || (m_fontCached.getFont().get() != m_wrappedTextFont)
+         || (m_textSize != m_wrappedTextSize) || (calculateWidths && !m_wrappedTextWidthsCalculated))
+        {
+            m_paragraphs.clear();
+            m_lines.clear();
+        }
+
+        // The editing code keeps track of the part of the text that changed since the last time
+        std::size_t unchangedStart = 0;
+        std::size_t unchangedEnd = 0;
+        if (!m_paragraphs.empty())
+        {
+            if (!m_textChanged)
+                return;
+
+            unchangedStart = m_unchangedTextStart;
+            unchangedEnd = m_unchangedTextEnd;
+        }
+
+        // Find the paragraphs that contain the changed characters. A paragraph includes the newline behind it,
+        // as removing or inserting a newline changes the next paragraph as well. The line containing the caret
+        // is always split again, because typing and pasting already insert the characters in that line.
+        std::size_t firstParagraph = 0;
+        std::size_t firstParagraphStart = 0;
+        std::size_t firstLine = 0;
+        std::size_t lastParagraph = 0;
+        std::size_t lastParagraphEnd = m_wrappedTextLength;
+        std::size_t lineCount = 0;
+        if (!m_paragraphs.empty())
+        {
+            while ((firstParagraphStart + m_paragraphs[firstParagraph].length < unchangedStart)
+                && (firstLine + m_paragraphs[firstParagraph].lineCount <= m_selEnd.y))
+            {
+                firstParagraphStart += m_paragraphs[firstParagraph].length + 1;
+                firstLine += m_paragraphs[firstParagraph].lineCount;
+                ++firstParagraph;
+            }
+
+            const std::size_t changeEnd = m_wrappedTextLength - unchangedEnd;
+            lastParagraph = firstParagraph;
+            lastParagraphEnd = firstParagraphStart + m_paragraphs[lastParagraph].length;
+            lineCount = m_paragraphs[lastParagraph].lineCount;
+            while ((lastParagraph + 1 < m_paragraphs.size())
+                && ((lastParagraphEnd < changeEnd) || (firstLine + lineCount <= m_selEnd.y)))
+            {
+                ++lastParagraph;
+                lastParagraphEnd += m_paragraphs[lastParagraph].length + 1;
+                lineCount += m_paragraphs[lastParagraph].lineCount;
+            }
+        }
+
+        // Split the changed paragraphs into lines again
+        const std::size_t changedTextEnd = lastParagraphEnd + m_text.getSize() - m_wrappedTextLength;
+        std::vector<Paragraph> newParagraphs;
+        std::vector<sf::String> newLines;
+        std::size_t paragraphStart = firstParagraphStart;
+        while (true)
+        {
+            std::size_t paragraphEnd = m_text.find('\n', paragraphStart);
+            if ((paragraphEnd == sf::String::InvalidPos) || (paragraphEnd > changedTextEnd))
+                paragraphEnd = changedTextEnd;
+
+            const sf::String paragraphText = m_text.substring(paragraphStart, paragraphEnd - paragraphStart);
+            const std::size_t oldLineCount = newLines.size();
+            if (maxLineWidth > 0)
+            {
+                const sf::String wrappedText = Text::wordWrap(maxLineWidth, paragraphText, m_fontCached, m_textSize, false, false);
+
+                std::size_t searchPosStart = 0;
+                std::size_t newLinePos = 0;
+                while (newLinePos != sf::String::InvalidPos)
+                {
+                    newLinePos = wrappedText.find('\n', searchPosStart);
+                    if (newLinePos != sf::String::InvalidPos)
+                        newLines.push_back(wrappedText.substring(searchPosStart, newLinePos - searchPosStart));
+                    else
+                        newLines.push_back(wrappedText.substring(searchPosStart));
+
+                    searchPosStart = newLinePos + 1;
+                }
+            }
+            else
+                newLines.push_back(paragraphText);
+
+            const float width = calculateWidths ? Text::getLineWidth(paragraphText, m_fontCached, m_textSize) : 0;
+            newParagraphs.push_back({paragraphText.getSize(), newLines.size() - oldLineCount, width});
+
+            if (paragraphEnd == changedTextEnd)
+                break;
+
+            paragraphStart = paragraphEnd + 1;
+        }
+
+        // Replace the lines and paragraphs that changed
+        m_lines.erase(m_lines.begin() + firstLine, m_lines.begin() + firstLine + lineCount);
+        m_lines.insert(m_lines.begin() + firstLine, std::make_move_iterator(newLines.begin()), std::make_move_iterator(newLines.end()));
+
+        if (!m_paragraphs.empty())
+            m_paragraphs.erase(m_paragraphs.begin() + firstParagraph, m_paragraphs.begin() + lastParagraph + 1);
+        m_paragraphs.insert(m_paragraphs.begin() + firstParagraph, newParagraphs.begin(), newParagraphs.end());
+
+        m_wrappedTextLength = m_text.getSize();
+        m_textChanged = false;
+        m_wrappedTextMaxWidth = maxLineWidth;
+        m_wrappedTextFont = m_fontCached.getFont().get();
+        m_wrappedTextSize = m_textSize;
+        m_wrappedTextWidthsCalculated = calculateWidths;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::updateScrollbars()
     {
         if (m_horizontalScrollbar->isShown())
@@ -1474,71 +1648,6 @@ namespace tgui
 
     void TextBox::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
-
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
-
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1553,14 +1662,15 @@ namespace tgui
 
         // Position the caret
         {
+            // The text is measured with the metrics of the font, which are scaled when the font has a glyph reference size
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            sf::Text tempText{m_lines[m_selEnd.y].substring(0, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
+            const float textWidth = Text::getLineWidth(m_lines[m_selEnd.y].substring(0, m_selEnd.x), m_fontCached, getTextSize());
 
             float kerning = 0;
             if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
                 kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+            m_caretPosition = {textOffset + textWidth + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
@@ -1618,6 +1728,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1633,9 +1745,8 @@ namespace tgui
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
 
-        // Calculate the position of the text objects
+        // Calculate the selection rectangles
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
         m_defaultText.setPosition({ textOffset, 0 });
 
         if (m_selStart != m_selEnd)
@@ -1654,70 +1765,152 @@ namespace tgui
             if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
                 kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
 
+            // The positions are calculated from the lines, as the text objects only contain the lines near the visible area
+            const auto getTextWidth = [this](const sf::String& text){
+                return Text::getLineWidth(text, m_fontCached, getTextSize());
+            };
+
+            float selectionStartX = textOffset;
             if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                selectionStartX += getTextWidth(m_lines[selectionStart.y].substring(0, selectionStart.x)) + kerningSelectionStart;
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+            m_selectionRects.push_back({selectionStartX, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
+            if (!m_lines[selectionStart.y].isEmpty())
             {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
+                if (selectionStart.y == selectionEnd.y)
+                {
+                    // There is kerning when the selection is on just this line
+                    m_selectionRects.back().width = getTextWidth(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x)) + kerningSelectionEnd;
+                }
+                else
+                    m_selectionRects.back().width = getTextWidth(m_lines[selectionStart.y].substring(selectionStart.x));
             }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+            for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
+            {
+                m_selectionRects.back().width += textOffset;
+                m_selectionRects.push_back({0, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+
+                if (!m_lines[i].isEmpty())
+                    m_selectionRects.back().width += getTextWidth(m_lines[i]);
+            }
 
-            // Recalculate the selection rectangles
+            if (selectionStart.y != selectionEnd.y)
             {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+                m_selectionRects.back().width += textOffset;
 
-                if (!m_lines[selectionStart.y].isEmpty())
+                if ((selectionEnd.y > selectionStart.y + 1) || (selectionEnd.x > 0))
                 {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
+                    m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                                textOffset + getTextWidth(m_lines[selectionEnd.y].substring(0, selectionEnd.x)) + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
                 }
+                else
+                    m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+            }
+        }
 
-                sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+        // Force the text objects to be filled again
+        m_firstTextLine = 0;
+        m_lastTextLine = 0;
 
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
+        recalculateVisibleLines();
+    }
 
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
+    void TextBox::updateSelectionTextStrings()
+    {
+        // Only the lines near the visible area are put in the text objects, with a margin of one page above and below
+        // so that scrolling doesn't require rebuilding them every time.
+        const std::size_t visibleLines = std::max<std::size_t>(m_visibleLines, 1);
+        m_firstTextLine = (m_topLine > visibleLines) ? (m_topLine - visibleLines) : 0;
+        m_lastTextLine = std::min(m_topLine + 2 * visibleLines, m_lines.size());
+        if (m_lastTextLine <= m_firstTextLine)
+        {
+            m_firstTextLine = m_lines.size() - 1;
+            m_lastTextLine = m_lines.size();
         }
 
-        recalculateVisibleLines();
+        const auto joinLines = [this](std::size_t first, std::size_t last){
+            sf::String string;
+            for (std::size_t i = std::max(first, m_firstTextLine); i < std::min(last, m_lastTextLine); ++i)
+                string += m_lines[i] + "\n";
+            return string;
+        };
+        const auto isLineInWindow = [this](std::size_t line){
+            return (line >= m_firstTextLine) && (line < m_lastTextLine);
+        };
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(m_firstTextLine * m_lineHeight)});
+
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(joinLines(0, m_lines.size()));
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+            return;
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        // Set the text before the selection
+        {
+            sf::String string = joinLines(0, selectionStart.y);
+            if (isLineInWindow(selectionStart.y))
+                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
+
+            m_textBeforeSelection.setString(string);
+        }
+
+        // Set the selected text
+        const std::size_t selection2FirstLine = std::max(selectionStart.y + 1, m_firstTextLine);
+        if (isLineInWindow(selectionStart.y))
+        {
+            if (selectionStart.y == selectionEnd.y)
+                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
+            else
+                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x));
+        }
+        else
+            m_textSelection1.setString("");
+
+        if (selectionStart.y != selectionEnd.y)
+        {
+            sf::String string = joinLines(selectionStart.y + 1, selectionEnd.y);
+            if (isLineInWindow(selectionEnd.y))
+                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+
+            m_textSelection2.setString(string);
+        }
+        else
+            m_textSelection2.setString("");
+
+        // Set the text after the selection
+        if (isLineInWindow(selectionEnd.y))
+            m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x));
+        else
+            m_textAfterSelection1.setString("");
+
+        m_textAfterSelection2.setString(joinLines(selectionEnd.y + 1, m_lines.size()));
+
+        // Position the text objects, the first selection rectangle starts where the selected text starts
+        // and the last rectangle ends where the text after the selection starts.
+        const float selectionStartX = m_selectionRects.empty() ? textOffset : m_selectionRects.front().left;
+        const float afterSelectionX = m_selectionRects.empty() ? textOffset : m_selectionRects.back().left + m_selectionRects.back().width;
+
+        m_textSelection1.setPosition({selectionStartX, static_cast<float>(selectionStart.y * m_lineHeight)});
+        m_textSelection2.setPosition({textOffset, static_cast<float>(selection2FirstLine * m_lineHeight)});
+        m_textAfterSelection1.setPosition({afterSelectionX, static_cast<float>(selectionEnd.y * m_lineHeight)});
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>(std::max(selectionEnd.y + 1, m_firstTextLine) * m_lineHeight)});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1752,6 +1945,11 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        // Fill the text objects again when lines become visible that they don't contain yet
+        const std::size_t lastVisibleLine = std::min(m_topLine + m_visibleLines, m_lines.size());
+        if ((m_lastTextLine == 0) || (m_topLine < m_firstTextLine) || (lastVisibleLine > m_lastTextLine))
+            updateSelectionTextStrings();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
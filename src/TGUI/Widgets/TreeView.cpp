@@ -33,6 +33,151 @@ namespace tgui
 {
     namespace
     {
+        // Children are only looked up with a hash map when there are enough of them to make hashing worth it
+        const std::size_t childIndexThreshold = 16;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::u32string toIndexKey(const sf::String& str)
+        {
+            return {str.begin(), str.end()};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TreeView::Node* findChildNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes,
+                                      std::unique_ptr<std::unordered_map<std::u32string, TreeView::Node*>>& index,
+                                      const sf::String& text)
+        {
+            if (nodes.size() < childIndexThreshold)
+            {
+                for (const auto& node : nodes)
+                {
+                    if (node->text.getString() == text)
+                        return node.get();
+                }
+
+                return nullptr;
+            }
+
+            // The index is build on the first lookup and kept up-to-date when children are added.
+            // When a child is removed the index is simply dropped and rebuild on the next lookup.
+            if (!index)
+            {
+                index = std::make_unique<std::unordered_map<std::u32string, TreeView::Node*>>();
+                index->reserve(nodes.size());
+                for (const auto& node : nodes)
+                    index->emplace(toIndexKey(node->text.getString()), node.get());
+            }
+
+            const auto it = index->find(toIndexKey(text));
+            if (it != index->end())
+                return it->second;
+            else
+                return nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TreeView::Node* findNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes,
+                                 std::unique_ptr<std::unordered_map<std::u32string, TreeView::Node*>>& index,
+                                 const std::vector<sf::String>& hierarchy)
+        {
+            if (hierarchy.empty())
+                return nullptr;
+
+            TreeView::Node* node = findChildNode(nodes, index, hierarchy[0]);
+            for (std::size_t i = 1; node && (i < hierarchy.size()); ++i)
+                node = findChildNode(node->nodes, node->childIndex, hierarchy[i]);
+
+            return node;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<sf::String> getNodeHierarchy(const TreeView::Node* node)
+        {
+            std::vector<sf::String> hierarchy;
+            while (node)
+            {
+                hierarchy.insert(hierarchy.begin(), node->text.getString());
+                node = node->parent;
+            }
+
+            return hierarchy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isNodeVisible(const TreeView::Node* node)
+        {
+            for (const TreeView::Node* parent = node->parent; parent; parent = parent->parent)
+            {
+                if (!parent->expanded)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the difference in rows of a child to its parent and to all ancestors of which the children are shown
+        void changeRowCounts(TreeView::Node* parent, std::ptrdiff_t difference)
+        {
+            while (parent && parent->expanded)
+            {
+                parent->rowCount = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(parent->rowCount) + difference);
+                parent = parent->parent;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the amount of rows taken by the siblings in front of the node. The list is searched from both ends
+        // so that nodes at the end, where items are being added, are found without visiting all their siblings.
+        std::size_t getRowsBeforeNode(const std::vector<std::shared_ptr<TreeView::Node>>& siblings, const TreeView::Node* node, std::size_t totalRows)
+        {
+            std::size_t rowsInFront = 0;
+            std::size_t rowsInBack = 0;
+            std::size_t front = 0;
+            std::size_t back = siblings.size();
+            while (true)
+            {
+                if (siblings[front].get() == node)
+                    return rowsInFront;
+
+                rowsInFront += siblings[front]->rowCount;
+                ++front;
+
+                --back;
+                rowsInBack += siblings[back]->rowCount;
+                if (siblings[back].get() == node)
+                    return totalRows - rowsInBack;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectVisibleNodes(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, std::vector<std::shared_ptr<TreeView::Node>>& visibleNodes)
+        {
+            for (const auto& node : nodes)
+            {
+                visibleNodes.push_back(node);
+                if (node->expanded)
+                    collectVisibleNodes(node->nodes, visibleNodes);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float getTextRight(const TreeView::Node& node)
+        {
+            return node.text.getPosition().x + node.text.getSize().x;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void setTextSizeImpl(std::vector<std::shared_ptr<TreeView::Node>>& nodes, unsigned int textSize)
         {
             for (auto& node : nodes)
@@ -75,6 +220,8 @@ namespace tgui
             newNode->text = oldNode->text;
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
+            newNode->lazyChildren = oldNode->lazyChildren;
+            newNode->rowCount = oldNode->rowCount;
             newNode->parent = parent;
 
             for (const auto& oldChild : oldNode->nodes)
@@ -107,52 +254,23 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void expandOrCollapseAll(std::vector<std::shared_ptr<TreeView::Node>>& nodes, bool expandNode)
+        // Returns the amount of rows taken by the nodes after expanding or collapsing them
+        std::size_t expandOrCollapseAll(std::vector<std::shared_ptr<TreeView::Node>>& nodes, bool expandNode)
         {
+            std::size_t rowCount = 0;
             for (auto& node : nodes)
             {
                 if (!node->nodes.empty())
                 {
                     node->expanded = expandNode;
-                    expandOrCollapseAll(node->nodes, expandNode);
-                }
-            }
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        bool removeItemImpl(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<std::shared_ptr<TreeView::Node>>& nodes)
-        {
-            for (auto it = nodes.begin(); it != nodes.end(); ++it)
-            {
-                if ((*it)->text.getString() != hierarchy[parentIndex])
-                    continue;
-
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    nodes.erase(it);
-                    return true;
+                    const std::size_t childRowCount = expandOrCollapseAll(node->nodes, expandNode);
+                    node->rowCount = expandNode ? (1 + childRowCount) : 1;
                 }
-                else
-                {
-                    // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes))
-                        return false;
-
-                    // If parents don't have to be removed as well then we are done
-                    if (!removeParentsWhenEmpty)
-                        return true;
-
-                    // Also delete the parent if empty
-                    if ((*it)->nodes.empty())
-                        nodes.erase(it);
 
-                    return true;
-                }
+                rowCount += node->rowCount;
             }
 
-            // The hierarchy doesn't exist
-            return false;
+            return rowCount;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,22 +289,6 @@ namespace tgui
             return constNodes;
         }
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        TreeView::Node* findNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, const std::vector<sf::String>& hierarchy, unsigned int parentIndex)
-        {
-            for (auto& node : nodes)
-            {
-                if (node->text.getString() != hierarchy[parentIndex])
-                    continue;
-                else if (parentIndex + 1 == hierarchy.size())
-                    return node.get();
-                else
-                    return findNode(node->nodes, hierarchy, parentIndex + 1);
-            }
-
-            return nullptr;
-        }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -260,6 +362,7 @@ namespace tgui
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
         onRightClick                        {other.onRightClick},
+        m_lazyItemLoader                    {other.m_lazyItemLoader},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -311,6 +414,8 @@ namespace tgui
             std::swap(onRightClick,                         temp.onRightClick);
             std::swap(m_nodes,                              temp.m_nodes);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
+            std::swap(m_rootIndex,                          temp.m_rootIndex);
+            std::swap(m_lazyItemLoader,                     temp.m_lazyItemLoader);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
             std::swap(m_itemHeight,                         temp.m_itemHeight);
@@ -403,28 +508,40 @@ namespace tgui
 
     bool TreeView::addItem(const std::vector<sf::String>& hierarchy, bool createParents)
     {
-        if (hierarchy.empty())
-            return false;
+        invalidate();
 
-        if (hierarchy.size() >= 2)
-        {
-            auto* node = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
-            if (!node)
-                return false;
+        return addItemImpl(hierarchy, createParents) != nullptr;
+    }
 
-            createNode(node->nodes, node, hierarchy.back());
-        }
-        else // Root node
-            createNode(m_nodes, nullptr, hierarchy.back());
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        markNodesDirty();
+    bool TreeView::addLazyItem(const std::vector<sf::String>& hierarchy, bool createParents)
+    {
+        invalidate();
+
+        auto* node = addItemImpl(hierarchy, createParents);
+        if (!node)
+            return false;
+
+        // The node has no children yet, so collapsing it doesn't change the amount of rows
+        node->lazyChildren = true;
+        node->expanded = false;
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TreeView::setLazyItemLoader(const std::function<void(const std::vector<sf::String>& hierarchy)>& loader)
+    {
+        m_lazyItemLoader = loader;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::expand(const std::vector<sf::String>& hierarchy)
     {
+        invalidate();
+
         expandOrCollapse(hierarchy, true);
     }
 
@@ -432,6 +549,8 @@ namespace tgui
 
     void TreeView::expandAll()
     {
+        invalidate();
+
         expandOrCollapseAll(m_nodes, true);
         markNodesDirty();
     }
@@ -440,6 +559,8 @@ namespace tgui
 
     void TreeView::collapse(const std::vector<sf::String>& hierarchy)
     {
+        invalidate();
+
         expandOrCollapse(hierarchy, false);
     }
 
@@ -447,6 +568,8 @@ namespace tgui
 
     void TreeView::collapseAll()
     {
+        invalidate();
+
         expandOrCollapseAll(m_nodes, false);
         markNodesDirty();
     }
@@ -455,6 +578,8 @@ namespace tgui
 
     bool TreeView::selectItem(const std::vector<sf::String>& hierarchy)
     {
+        invalidate();
+
         // Make sure the parent of the item we are selecting is expanded
         if (hierarchy.size() >= 2)
         {
@@ -462,26 +587,20 @@ namespace tgui
                 return false;
         }
 
-        auto* node = findNode(m_nodes, hierarchy, 0);
+        auto* node = findNode(m_nodes, m_rootIndex, hierarchy);
         if (!node)
             return false;
 
-        for (unsigned int i = 0; i < m_visibleNodes.size(); ++i)
-        {
-            if (m_visibleNodes[i].get() == node)
-            {
-                updateSelectedItem(i);
-                return true;
-            }
-        }
-
-        return false;
+        updateSelectedItem(static_cast<int>(getNodeRow(node)));
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TreeView::deselectItem()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 
@@ -489,16 +608,31 @@ namespace tgui
 
     bool TreeView::removeItem(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty)
     {
-        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
-        markNodesDirty();
-        return ret;
+        invalidate();
+
+        auto* node = findNode(m_nodes, m_rootIndex, hierarchy);
+        if (!node)
+            return false;
+
+        // Instead of removing the parents afterwards, remove the highest parent that would become empty
+        if (removeParentsWhenEmpty)
+        {
+            while (node->parent && (node->parent->nodes.size() == 1))
+                node = node->parent;
+        }
+
+        removeNode(node);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TreeView::removeAllItems()
     {
+        invalidate();
+
         m_nodes.clear();
+        m_rootIndex = nullptr;
         markNodesDirty();
     }
 
@@ -523,29 +657,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    TreeView::Node* TreeView::addItemImpl(const std::vector<sf::String>& hierarchy, bool createParents)
+    {
+        if (hierarchy.empty())
+            return nullptr;
+
+        if (hierarchy.size() >= 2)
+        {
+            auto* parent = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
+            if (!parent)
+                return nullptr;
+
+            return createNode(parent->nodes, parent, hierarchy.back());
+        }
+        else // Root node
+            return createNode(m_nodes, nullptr, hierarchy.back());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::toggleNodeInternal(std::size_t index)
     {
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        auto* node = m_visibleNodes[index].get();
+        if (node->nodes.empty() && !node->lazyChildren)
             return;
 
-        std::vector<sf::String> hierarchy;
-        auto* node = m_visibleNodes[index].get();
-        while (node)
-        {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
-            node = node->parent;
-        }
+        setNodeExpanded(node, !node->expanded);
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+        const std::vector<sf::String> hierarchy = getNodeHierarchy(node);
+        if (node->expanded)
             onExpand.emit(this, hierarchy.back(), hierarchy);
         else
             onCollapse.emit(this, hierarchy.back(), hierarchy);
-
-        markNodesDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -588,6 +734,8 @@ namespace tgui
 
     void TreeView::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
             setTextSize(0);
@@ -609,6 +757,8 @@ namespace tgui
 
     void TreeView::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -623,6 +773,8 @@ namespace tgui
 
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_verticalScrollbar->setValue(value);
     }
 
@@ -637,6 +789,8 @@ namespace tgui
 
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
+        invalidate();
+
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -803,6 +957,7 @@ namespace tgui
         if (!m_mouseHover)
             mouseEnteredWidget();
 
+        const int oldHoveredItem = m_hoveredItem;
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->mouseOnWidget(pos))
             m_verticalScrollbar->mouseMoved(pos);
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->mouseOnWidget(pos))
@@ -830,6 +985,12 @@ namespace tgui
             else // Mouse is on top of padding or borders
                 updateHoveredItem(-1);
         }
+
+        // The scrollbars aren't added to a container, so the tree view has to be redrawn when a scrollbar changed
+        const bool verticalScrollbarChanged = m_verticalScrollbar->wasInvalidatedWithoutParent();
+        const bool horizontalScrollbarChanged = m_horizontalScrollbar->wasInvalidatedWithoutParent();
+        if (verticalScrollbarChanged || horizontalScrollbarChanged || (m_hoveredItem != oldHoveredItem))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1093,29 +1254,181 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int TreeView::updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos)
+    void TreeView::updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding)
     {
         for (auto& node : nodes)
         {
-            m_visibleNodes.push_back(node);
             if (selectedNode == node.get())
-                m_selectedItem = pos;
+                m_selectedItem = static_cast<int>(m_visibleNodes.size());
 
-            const float iconPadding = (m_iconBounds.x / 4.f);
-            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition(iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                   (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f));
+            m_visibleNodes.push_back(node);
+
+            updateTextPosition(*node, textPadding);
 
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
+            const float right = getTextRight(*node) + m_paddingCached.getRight();
             if (right > m_maxRight)
                 m_maxRight = right;
 
-            pos++;
             if (node->expanded && !node->nodes.empty())
-                pos = updateVisibleNodes(node->nodes, selectedNode, textPadding, pos);
+                updateVisibleNodes(node->nodes, selectedNode, textPadding);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateTextPosition(Node& node, float textPadding)
+    {
+        // The text is positioned relative to its row, so that it doesn't has to be moved when rows are inserted or removed
+        const float iconPadding = (m_iconBounds.x / 4.f);
+        const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node.depth);
+        node.text.setPosition(iconOffset + m_iconBounds.x + iconPadding + textPadding, (m_itemHeight - node.text.getSize().y) / 2.f);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getNodeRow(const Node* node) const
+    {
+        std::size_t row = 0;
+        for (; node; node = node->parent)
+        {
+            if (node->parent)
+                row += 1 + getRowsBeforeNode(node->parent->nodes, node, node->parent->rowCount - 1);
+            else
+                row += getRowsBeforeNode(m_nodes, node, m_visibleNodes.size());
+        }
+
+        return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::insertVisibleNodes(std::size_t row, const std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        // The hovered row is kept, but the colors have to be reset for the item that moves away from it
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        for (const auto& node : nodes)
+        {
+            updateTextPosition(*node, textPadding);
+
+            const float right = getTextRight(*node) + m_paddingCached.getRight();
+            if (right > m_maxRight)
+                m_maxRight = right;
+        }
+
+        m_visibleNodes.insert(m_visibleNodes.begin() + static_cast<std::ptrdiff_t>(row), nodes.begin(), nodes.end());
+
+        if (m_selectedItem >= static_cast<int>(row))
+            m_selectedItem += static_cast<int>(nodes.size());
+
+        updateHoveredItem(oldHoveredItem);
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::eraseVisibleNodes(std::size_t row, std::size_t count)
+    {
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        const int firstItem = static_cast<int>(row);
+        const int lastItem = static_cast<int>(row + count);
+        if (m_selectedItem >= lastItem)
+            m_selectedItem -= static_cast<int>(count);
+        else if (m_selectedItem >= firstItem)
+        {
+            // The selected item is no longer visible, so it is deselected
+            m_visibleNodes[m_selectedItem]->text.setColor(m_textColorCached);
+            m_selectedItem = -1;
+        }
+
+        // The widest items only have to be searched again when the widest item is being removed
+        bool maxRightRemoved = false;
+        for (int i = firstItem; i < lastItem; ++i)
+        {
+            if (getTextRight(*m_visibleNodes[i]) + m_paddingCached.getRight() >= m_maxRight)
+                maxRightRemoved = true;
+        }
+
+        m_visibleNodes.erase(m_visibleNodes.begin() + firstItem, m_visibleNodes.begin() + lastItem);
+
+        if (maxRightRemoved)
+        {
+            m_maxRight = 0;
+            for (const auto& node : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, getTextRight(*node) + m_paddingCached.getRight());
+        }
+
+        if (oldHoveredItem < static_cast<int>(m_visibleNodes.size()))
+            updateHoveredItem(oldHoveredItem);
+
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::setNodeExpanded(Node* node, bool expand)
+    {
+        if (expand && node->lazyChildren)
+        {
+            // The node is still collapsed while its children are being added, so they don't have to be shown one by one
+            node->lazyChildren = false;
+            if (m_lazyItemLoader)
+                m_lazyItemLoader(getNodeHierarchy(node));
+        }
+
+        if (node->expanded == expand)
+            return;
+
+        const bool visible = isNodeVisible(node);
+        const std::size_t row = visible ? getNodeRow(node) : 0;
+        if (expand)
+        {
+            std::size_t childRowCount = 0;
+            for (const auto& child : node->nodes)
+                childRowCount += child->rowCount;
+
+            node->expanded = true;
+            node->rowCount = 1 + childRowCount;
+            changeRowCounts(node->parent, static_cast<std::ptrdiff_t>(childRowCount));
+
+            if (visible && (childRowCount > 0))
+            {
+                std::vector<std::shared_ptr<Node>> newVisibleNodes;
+                newVisibleNodes.reserve(childRowCount);
+                collectVisibleNodes(node->nodes, newVisibleNodes);
+                insertVisibleNodes(row + 1, newVisibleNodes);
+            }
         }
+        else // Collapsing
+        {
+            const std::size_t childRowCount = node->rowCount - 1;
+            changeRowCounts(node->parent, -static_cast<std::ptrdiff_t>(childRowCount));
+            node->expanded = false;
+            node->rowCount = 1;
 
-        return pos;
+            if (visible && (childRowCount > 0))
+                eraseVisibleNodes(row + 1, childRowCount);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::removeNode(Node* node)
+    {
+        if (isNodeVisible(node))
+            eraseVisibleNodes(getNodeRow(node), node->rowCount);
+
+        changeRowCounts(node->parent, -static_cast<std::ptrdiff_t>(node->rowCount));
+
+        auto& siblings = node->parent ? node->parent->nodes : m_nodes;
+        auto& index = node->parent ? node->parent->childIndex : m_rootIndex;
+        index = nullptr;
+
+        siblings.erase(std::find_if(siblings.begin(), siblings.end(), [node](const std::shared_ptr<Node>& sibling){ return sibling.get() == node; }));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1132,7 +1445,11 @@ namespace tgui
         m_hoveredItem = -1;
         m_selectedItem = -1;
         m_visibleNodes.clear();
-        updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSize), 0);
+        updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSize));
+
+        // Reset the color of the selected item if it was hidden
+        if (selectedNode && (m_selectedItem < 0))
+            selectedNode->text.setColor(m_textColorCached);
 
         if (oldHoveredItem >= 0)
         {
@@ -1143,6 +1460,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1248,7 +1572,7 @@ namespace tgui
                 statesForIcon.transform.translate(std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f)));
 
                 // Draw an icon for the leaf node if a texture is set
-                if (m_visibleNodes[i]->nodes.empty())
+                if (m_visibleNodes[i]->nodes.empty() && !m_visibleNodes[i]->lazyChildren)
                 {
                     if (m_spriteLeaf.isSet())
                         m_spriteLeaf.draw(target, statesForIcon);
@@ -1316,7 +1640,11 @@ namespace tgui
 
             // Draw the texts
             for (int i = firstNode; i < lastNode; ++i)
-                m_visibleNodes[i]->text.draw(target, states);
+            {
+                auto statesForText = states;
+                statesForText.transform.translate(0, static_cast<float>(i * m_itemHeight));
+                m_visibleNodes[i]->text.draw(target, statesForText);
+            }
         }
 
         m_horizontalScrollbar->draw(target, statesForScrollbars);
@@ -1325,7 +1653,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const sf::String& text)
+    TreeView::Node* TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const sf::String& text)
     {
         auto newNode = std::make_shared<Node>();
         newNode->text.setFont(m_fontCached);
@@ -1341,71 +1669,48 @@ namespace tgui
         else
             newNode->depth = 0;
 
+        auto& index = parent ? parent->childIndex : m_rootIndex;
+        if (index)
+            index->emplace(toIndexKey(text), newNode.get());
+
+        // The new node is placed on the row below the last visible child of the parent
+        const bool visible = !parent || (parent->expanded && isNodeVisible(parent));
+        std::size_t row = 0;
+        if (visible)
+            row = parent ? (getNodeRow(parent) + parent->rowCount) : m_visibleNodes.size();
+
         nodes.push_back(std::move(newNode));
+        changeRowCounts(parent, 1);
+
+        if (visible)
+            insertVisibleNodes(row, {nodes.back()});
+
+        return nodes.back().get();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool TreeView::expandOrCollapse(const std::vector<sf::String>& hierarchy, bool expandNode)
     {
-        if (hierarchy.empty())
-            return false;
+        invalidate();
 
-        if (hierarchy.size() >= 2)
-        {
-            auto* node = findNode(m_nodes, hierarchy, 0);
-            if (!node)
-                return false;
-
-            bool nodeChanged = false;
-            if (expandNode)
-            {
-                // When expanding, also expand all parents
-                auto* nodeToExpand = node;
-                while (nodeToExpand)
-                {
-                    if (nodeToExpand->expanded != expandNode)
-                    {
-                        nodeToExpand->expanded = expandNode;
-                        nodeChanged = true;
-                    }
-
-                    nodeToExpand = nodeToExpand->parent;
-                }
-            }
-            else // Collapsing
-            {
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    nodeChanged = true;
-                }
-            }
-
-
-            if (nodeChanged)
-                markNodesDirty();
+        auto* node = findNode(m_nodes, m_rootIndex, hierarchy);
+        if (!node)
+            return false;
 
-            return true;
-        }
-        else // Root node
+        if (expandNode)
         {
-            for (auto& node : m_nodes)
+            // When expanding, also expand all parents
+            while (node)
             {
-                if (node->text.getString() != hierarchy.back())
-                    continue;
-
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    markNodesDirty();
-                }
-
-                return true;
+                setNodeExpanded(node, true);
+                node = node->parent;
             }
         }
+        else // Collapsing
+            setNodeExpanded(node, false);
 
-        return false;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1495,26 +1800,19 @@ namespace tgui
 
     TreeView::Node* TreeView::findParentNode(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents)
     {
-        for (auto& node : nodes)
+        auto* node = findChildNode(nodes, parent ? parent->childIndex : m_rootIndex, hierarchy[parentIndex]);
+        if (!node)
         {
-            if (node->text.getString() != hierarchy[parentIndex])
-                continue;
-            else if (parentIndex + 2 == hierarchy.size())
-                return node.get();
-            else
-                return findParentNode(hierarchy, parentIndex + 1, node->nodes, node.get(), createParents);
-        }
+            if (!createParents)
+                return nullptr;
 
-        if (createParents)
-        {
-            createNode(nodes, parent, hierarchy[parentIndex]);
-            if (parentIndex + 2 == hierarchy.size())
-                return nodes.back().get();
-            else
-                return findParentNode(hierarchy, parentIndex + 1, nodes.back()->nodes, nodes.back().get(), createParents);
+            node = createNode(nodes, parent, hierarchy[parentIndex]);
         }
 
-        return nullptr;
+        if (parentIndex + 2 == hierarchy.size())
+            return node;
+        else
+            return findParentNode(hierarchy, parentIndex + 1, node->nodes, node, createParents);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,312 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Clipboard.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ListView.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <chrono>
+
+// The benchmarks are hidden test cases, run them explicitly with the "[benchmark]" tag (e.g. "tests [benchmark]").
+// They require a release build to give meaningful numbers and report their results as warnings.
+
+namespace
+{
+    // Calls the function repeatedly for half a second and returns how many times per second it was called
+    template <typename Function>
+    double callsPerSecond(const Function& function)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::size_t calls = 0;
+        std::chrono::duration<double> elapsed{};
+        const auto start = Clock::now();
+        do
+        {
+            function();
+            ++calls;
+            elapsed = Clock::now() - start;
+        }
+        while (elapsed.count() < 0.5);
+
+        return calls / elapsed.count();
+    }
+}
+
+TEST_CASE("[Benchmark] Signal emit", "[.benchmark]")
+{
+    auto widget = tgui::ClickableWidget::create();
+    tgui::SignalFloat signal{"ValueChanged"};
+
+    float sum = 0;
+    for (const unsigned int handlerCount : {1u, 10u})
+    {
+        signal.disconnectAll();
+        for (unsigned int i = 0; i < handlerCount; ++i)
+            signal.connect([&](float value){ sum += value; });
+
+        const double emitsPerSecond = 1000 * callsPerSecond([&]{
+            for (unsigned int i = 0; i < 1000; ++i)
+                signal.emit(widget.get(), 1);
+        });
+
+        WARN("Signal::emit with " << handlerCount << " handler(s): " << static_cast<std::size_t>(emitsPerSecond) << " emits/s");
+    }
+
+    REQUIRE(sum > 0);
+}
+
+TEST_CASE("[Benchmark] TextBox editing", "[.benchmark]")
+{
+    auto textBox = tgui::TextBox::create();
+    textBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    textBox->setSize(800, 600);
+
+    // Create a document of about 8 MB, with a line of 80 characters per paragraph
+    const sf::String line = sf::String(std::string(79, 'x')) + "\n";
+    sf::String document;
+    for (unsigned int i = 0; i < 100000; ++i)
+        document += line;
+
+    const auto start = std::chrono::steady_clock::now();
+    textBox->setText(document);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    WARN("TextBox::setText with " << document.getSize() << " characters: " << elapsed.count() * 1000 << " ms");
+
+    textBox->setCaretPosition(document.getSize() / 2);
+
+    sf::Event::KeyEvent backspaceEvent;
+    backspaceEvent.code = sf::Keyboard::BackSpace;
+    backspaceEvent.control = false;
+    backspaceEvent.alt = false;
+    backspaceEvent.shift = false;
+    backspaceEvent.system = false;
+
+    const double keystrokesPerSecond = 2 * callsPerSecond([&]{
+        textBox->textEntered('a');
+        textBox->keyPressed(backspaceEvent);
+    });
+    WARN("Typing in the middle of the TextBox: " << static_cast<std::size_t>(keystrokesPerSecond) << " keystrokes/s");
+
+    sf::Event::KeyEvent pasteEvent = backspaceEvent;
+    pasteEvent.code = sf::Keyboard::V;
+    pasteEvent.control = true;
+
+    tgui::Clipboard::set(sf::String(std::string(1000, 'y')));
+    const double pastesPerSecond = callsPerSecond([&]{
+        textBox->keyPressed(pasteEvent);
+    });
+    WARN("Pasting 1000 characters in the middle of the TextBox: " << static_cast<std::size_t>(pastesPerSecond) << " pastes/s");
+
+    REQUIRE(textBox->getText().getSize() > document.getSize());
+}
+
+TEST_CASE("[Benchmark] ChatBox log stream", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    chatBox->setSize(400, 300);
+    gui.add(chatBox);
+
+    // Append 1M lines, with 1000 lines being added before every frame
+    const unsigned int frameCount = 1000;
+    const unsigned int linesPerFrame = 1000;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int frame = 0; frame < frameCount; ++frame)
+    {
+        for (unsigned int i = 0; i < linesPerFrame; ++i)
+            chatBox->addLine("Log message " + tgui::to_string(frame * linesPerFrame + i));
+
+        target.clear();
+        gui.draw();
+        target.display();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    WARN("ChatBox with " << frameCount * linesPerFrame << " lines appended at " << linesPerFrame << " lines per frame: "
+         << static_cast<std::size_t>(frameCount * linesPerFrame / elapsed.count()) << " lines/s, "
+         << elapsed.count() * 1000 / frameCount << " ms per frame");
+
+    REQUIRE(chatBox->getLineAmount() == frameCount * linesPerFrame);
+}
+
+TEST_CASE("[Benchmark] Text word wrap", "[.benchmark]")
+{
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+
+    // About 1 MB of ASCII text, consisting of words with different lengths
+    std::string text;
+    while (text.size() < 1000000)
+        text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+
+    const sf::String string{text};
+    for (const bool bold : {false, true})
+    {
+        std::size_t wrappedSize = 0;
+        const double wrapsPerSecond = callsPerSecond([&]{
+            wrappedSize = tgui::Text::wordWrap(300, string, font, 14, bold).getSize();
+        });
+
+        WARN("Text::wordWrap" << (bold ? " with bold text: " : ": ")
+             << wrapsPerSecond * text.size() / 1000000 << " MB/s");
+
+        REQUIRE(wrappedSize > 0);
+    }
+}
+
+TEST_CASE("[Benchmark] Drawing a table", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(1920, 1080);
+    tgui::Gui gui{target};
+
+    // A list view with 10 columns and 1000 rows, which is 10k cells
+    auto listView = tgui::ListView::create();
+    listView->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    listView->setSize(1920, 1080);
+    for (unsigned int column = 0; column < 10; ++column)
+        listView->addColumn("Column " + tgui::to_string(column), 190);
+
+    for (unsigned int row = 0; row < 1000; ++row)
+    {
+        std::vector<sf::String> item;
+        for (unsigned int column = 0; column < 10; ++column)
+            item.push_back(tgui::to_string(row) + "," + tgui::to_string(column));
+
+        listView->addItem(item);
+    }
+    gui.add(listView);
+
+    for (const bool batching : {false, true})
+    {
+        gui.setDrawBatchingEnabled(batching);
+
+        const double framesPerSecond = callsPerSecond([&]{
+            target.clear();
+            gui.draw();
+            target.display();
+        });
+
+        WARN("ListView with 10k cells" << (batching ? " with batching: " : " without batching: ")
+             << gui.getDrawCallCount() << " draw calls, " << 1000 / framesPerSecond << " ms per frame");
+
+        REQUIRE(gui.getDrawCallCount() > 0);
+    }
+}
+
+TEST_CASE("[Benchmark] EditBox validators", "[.benchmark]")
+{
+    auto editBox = tgui::EditBox::create();
+    editBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+    editBox->setSize(800, 30);
+
+    sf::Event::KeyEvent backspaceEvent;
+    backspaceEvent.code = sf::Keyboard::BackSpace;
+    backspaceEvent.control = false;
+    backspaceEvent.alt = false;
+    backspaceEvent.shift = false;
+    backspaceEvent.system = false;
+
+    auto measure = [&](const std::string& name){
+        editBox->setText("1234567890");
+
+        const double keystrokesPerSecond = 2 * callsPerSecond([&]{
+            editBox->textEntered('5');
+            editBox->keyPressed(backspaceEvent);
+        });
+
+        WARN("Typing in an EditBox with the " << name << " validator: " << static_cast<std::size_t>(keystrokesPerSecond) << " keystrokes/s");
+        REQUIRE(editBox->getText() == "1234567890");
+    };
+
+    editBox->setInputValidator(tgui::EditBox::Validator::All);
+    measure("All");
+
+    editBox->setInputValidator(tgui::EditBox::Validator::Int);
+    measure("Int");
+
+    editBox->setInputValidator(tgui::EditBox::Validator::UInt);
+    measure("UInt");
+
+    editBox->setInputValidator(tgui::EditBox::Validator::Float);
+    measure("Float");
+
+    editBox->setInputValidator("[0-9]{0,20}");
+    measure("regex");
+
+    editBox->setInputValidatorFunction([](const sf::String& text){ return text.getSize() <= 20; });
+    measure("function");
+}
+
+TEST_CASE("[Benchmark] Mouse move hit test", "[.benchmark]")
+{
+    sf::RenderTexture target;
+    target.create(1000, 1000);
+    tgui::Gui gui{target};
+
+    // A panel filled with a grid of 100x100 buttons
+    auto panel = tgui::Panel::create({1000, 1000});
+    for (unsigned int y = 0; y < 100; ++y)
+    {
+        for (unsigned int x = 0; x < 100; ++x)
+        {
+            auto button = tgui::Button::create();
+            button->setPosition(x * 10.f, y * 10.f);
+            button->setSize(9, 9);
+            panel->add(button);
+        }
+    }
+    gui.add(panel);
+
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+
+    for (const bool spatialIndex : {false, true})
+    {
+        panel->setSpatialIndexEnabled(spatialIndex);
+
+        unsigned int i = 0;
+        const double movesPerSecond = 1000 * callsPerSecond([&]{
+            for (unsigned int j = 0; j < 1000; ++j, ++i)
+            {
+                event.mouseMove.x = static_cast<int>((i * 7) % 1000);
+                event.mouseMove.y = static_cast<int>((i * 13) % 1000);
+                gui.handleEvent(event);
+            }
+        });
+
+        WARN("Mouse moves over 10k buttons" << (spatialIndex ? " with spatial index: " : " with linear scan: ")
+             << static_cast<std::size_t>(movesPerSecond) << " events/s");
+    }
+
+    REQUIRE(panel->isSpatialIndexEnabled());
+}
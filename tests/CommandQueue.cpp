@@ -0,0 +1,192 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("[CommandQueue]")
+{
+    tgui::CommandQueue queue;
+    REQUIRE(queue.isEmpty());
+    REQUIRE(queue.execute() == 0);
+
+    SECTION("Order")
+    {
+        std::string order;
+        queue.post([&]{ order += "1"; });
+        queue.post([&]{ order += "2"; });
+        queue.post([&]{ order += "3"; });
+        REQUIRE(!queue.isEmpty());
+        REQUIRE(order.empty());
+
+        REQUIRE(queue.execute() == 3);
+        REQUIRE(order == "123");
+        REQUIRE(queue.isEmpty());
+    }
+
+    SECTION("Keys")
+    {
+        std::string order;
+        queue.post([&]{ order += "a1"; }, "a");
+        queue.post([&]{ order += "1"; });
+        queue.post([&]{ order += "b1"; }, "b");
+        queue.post([&]{ order += "a2"; }, "a");
+        queue.post([&]{ order += "2"; });
+        queue.post([&]{ order += "a3"; }, "a");
+
+        // Only the last command with each key is executed, at the position where it was posted
+        REQUIRE(queue.execute() == 4);
+        REQUIRE(order == "1b12a3");
+
+        order.clear();
+        queue.post([&]{ order += "a4"; }, "a");
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(order == "a4");
+    }
+
+    SECTION("Appends")
+    {
+        std::string order;
+        std::vector<std::string> calls;
+        const auto append = [&](std::vector<std::string>& values){
+            std::string call;
+            for (const auto& value : values)
+                call += value;
+
+            calls.push_back(call);
+            order += "[" + call + "]";
+        };
+
+        queue.postAppend<std::string>("a", append, "log");
+        queue.post([&]{ order += "1"; });
+        queue.postAppend<std::string>("b", append, "log");
+        queue.postAppend<std::string>("x", append, "other");
+        queue.postAppend<std::string>("c", append, "log");
+        queue.post([&]{ order += "2"; }, "log");
+
+        // The values with the same key are passed together at the position of the first one
+        REQUIRE(queue.execute() == 4);
+        REQUIRE(calls == std::vector<std::string>{"abc", "x"});
+        REQUIRE(order == "[abc]1[x]2");
+
+        calls.clear();
+        queue.postAppend<std::string>("d", append, "log");
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(calls == std::vector<std::string>{"d"});
+    }
+
+    SECTION("Exceptions")
+    {
+        std::string order;
+        queue.post([&]{ order += "1"; });
+        queue.post([&]{ throw std::runtime_error("first"); });
+        queue.post([&]{ order += "2"; });
+        queue.post([&]{ throw std::runtime_error("second"); });
+        queue.post([&]{ order += "3"; });
+
+        // All commands are executed before the first exception is passed on
+        REQUIRE_THROWS_WITH(queue.execute(), "first");
+        REQUIRE(order == "123");
+        REQUIRE(queue.isEmpty());
+    }
+
+    SECTION("Posting while executing")
+    {
+        std::string order;
+        queue.post([&]{ order += "1"; queue.post([&]{ order += "3"; }); });
+        queue.post([&]{ order += "2"; });
+
+        REQUIRE(queue.execute() == 2);
+        REQUIRE(order == "12");
+        REQUIRE(!queue.isEmpty());
+
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(order == "123");
+    }
+
+    SECTION("Multiple threads")
+    {
+        const unsigned int threadCount = 4;
+        const unsigned int commandsPerThread = 1000;
+
+        std::vector<std::vector<unsigned int>> values(threadCount);
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&,i]{
+                for (unsigned int j = 0; j < commandsPerThread; ++j)
+                    queue.post([&,i,j]{ values[i].push_back(j); });
+            });
+        }
+
+        std::size_t executed = 0;
+        while (executed < threadCount * commandsPerThread)
+            executed += queue.execute();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // The commands of each thread are executed in the order in which that thread posted them
+        std::vector<unsigned int> expectedValues(commandsPerThread);
+        for (unsigned int j = 0; j < commandsPerThread; ++j)
+            expectedValues[j] = j;
+
+        REQUIRE(executed == threadCount * commandsPerThread);
+        for (unsigned int i = 0; i < threadCount; ++i)
+            REQUIRE(values[i] == expectedValues);
+    }
+
+    SECTION("Gui")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+        tgui::Gui gui{target};
+
+        auto progressBar = tgui::ProgressBar::create();
+        gui.add(progressBar);
+
+        std::thread thread([&]{
+            for (unsigned int i = 1; i <= 50; ++i)
+                gui.getCommandQueue().post([=]{ progressBar->setValue(i); }, "progress");
+        });
+        thread.join();
+
+        unsigned int valueChangedCount = 0;
+        progressBar->connect("ValueChanged", [&]{ ++valueChangedCount; });
+
+        REQUIRE(progressBar->getValue() == 0);
+        gui.updateTime();
+        REQUIRE(progressBar->getValue() == 50);
+        REQUIRE(valueChangedCount == 1);
+        REQUIRE(gui.getCommandQueue().isEmpty());
+
+        // The queue is also executed when passing the elapsed time yourself
+        gui.getCommandQueue().post([=]{ progressBar->setValue(20); });
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(progressBar->getValue() == 20);
+    }
+}
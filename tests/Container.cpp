@@ -25,6 +25,43 @@
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
 
+namespace
+{
+    class DrawCountingWidget : public tgui::ClickableWidget
+    {
+    public:
+        DrawCountingWidget(unsigned int& drawCount) :
+            m_drawCount(drawCount)
+        {
+        }
+
+        void draw(sf::RenderTarget&, sf::RenderStates) const override
+        {
+            ++m_drawCount;
+        }
+
+    private:
+        unsigned int& m_drawCount;
+    };
+
+    class HitTestGroup : public tgui::Group
+    {
+    public:
+        using tgui::Group::mouseOnWhichWidget;
+    };
+
+    // Returns the index of the widget below the mouse, or -1 when the mouse isn't on any widget
+    int findWidgetIndex(HitTestGroup& group, tgui::Vector2f pos)
+    {
+        const auto widget = group.mouseOnWhichWidget(pos);
+        if (!widget)
+            return -1;
+
+        const auto& widgets = group.getWidgets();
+        return static_cast<int>(std::find(widgets.begin(), widgets.end(), widget) - widgets.begin());
+    }
+}
+
 TEST_CASE("[Container]")
 {
     auto container = std::make_shared<tgui::Gui>();
@@ -72,6 +109,39 @@ TEST_CASE("[Container]")
         REQUIRE(container->getWidgets()[2]->getWidgetName() == "widget3");
     }
 
+    SECTION("addBulk")
+    {
+        container->removeAllWidgets();
+
+        auto w1 = tgui::ClickableWidget::create();
+        auto w2 = tgui::ClickableWidget::create();
+        auto w3 = tgui::ClickableWidget::create();
+        container->add(w1, "widget1");
+
+        // Widgets that already have a parent are moved to the container
+        widget2->add(w3, "widget3");
+        container->addBulk({w2, w3});
+
+        REQUIRE(container->getWidgets().size() == 3);
+        REQUIRE(container->getWidgets()[0] == w1);
+        REQUIRE(container->getWidgets()[1] == w2);
+        REQUIRE(container->getWidgets()[2] == w3);
+        REQUIRE(w2->getParent() == container->getContainer().get());
+        REQUIRE(w3->getParent() == container->getContainer().get());
+        REQUIRE(w3->getWidgetName() == "");
+        REQUIRE(widget2->getWidgets().size() == 2);
+
+        container->addBulk({});
+        REQUIRE(container->getWidgets().size() == 3);
+
+        // Inherited properties are applied to every widget
+        auto panel = tgui::Panel::create();
+        panel->setTextSize(19);
+        panel->addBulk({tgui::Label::create(), tgui::Label::create()});
+        REQUIRE(panel->getWidgets()[0]->getTextSize() == 19);
+        REQUIRE(panel->getWidgets()[1]->getTextSize() == 19);
+    }
+
     SECTION("get")
     {
         SECTION("normal function")
@@ -243,6 +313,156 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Widgets outside visible area are not drawn")
+    {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::ScrollablePanel::create({100, 100});
+        panel->getRenderer()->setBorders(0);
+        panel->getRenderer()->setPadding(0);
+        panel->setPosition(50, 50);
+        gui.add(panel);
+
+        unsigned int drawCount = 0;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto widget = std::make_shared<DrawCountingWidget>(drawCount);
+            widget->setSize(20, 20);
+            widget->setPosition(0, i * 25.f);
+            panel->add(widget);
+        }
+
+        // Widgets at 0, 25, 50, 75 and 100 (which touches the border)
+        gui.draw();
+        REQUIRE(drawCount == 5);
+
+        drawCount = 0;
+        panel->setVerticalScrollbarValue(500);
+        gui.draw();
+        REQUIRE(drawCount == 5);
+
+        // The spatial index finds the same widgets without checking all of them
+        panel->setSpatialIndexEnabled(true);
+        drawCount = 0;
+        gui.draw();
+        REQUIRE(drawCount == 5);
+
+        drawCount = 0;
+        panel->getWidgets()[30]->setPosition(0, 560);
+        gui.draw();
+        REQUIRE(drawCount == 6);
+
+        // The panel lies partly outside the render target
+        drawCount = 0;
+        panel->setVerticalScrollbarValue(0);
+        panel->setPosition(150, 150);
+        gui.draw();
+        REQUIRE(drawCount == 3);
+
+        // Widgets are also skipped when the panel is placed inside another panel
+        drawCount = 0;
+        gui.remove(panel);
+        auto parentPanel = tgui::Panel::create({100, 100});
+        parentPanel->getRenderer()->setBorders(0);
+        parentPanel->getRenderer()->setPadding(0);
+        parentPanel->add(panel);
+        gui.add(parentPanel);
+        panel->setPosition(0, 50);
+        gui.draw();
+        REQUIRE(drawCount == 3);
+
+        drawCount = 0;
+        panel->setPosition(0, 150);
+        gui.draw();
+        REQUIRE(drawCount == 0);
+
+        // Children of a radio button group aren't clipped, so the group is always drawn
+        auto group = tgui::RadioButtonGroup::create();
+        group->setSize(10, 10);
+        group->setPosition(500, 500);
+        auto widget = std::make_shared<DrawCountingWidget>(drawCount);
+        group->add(widget);
+        gui.add(group);
+        gui.draw();
+        REQUIRE(drawCount == 0);
+
+        widget->setPosition(-450, -450);
+        gui.draw();
+        REQUIRE(drawCount == 1);
+    }
+
+    SECTION("Spatial index")
+    {
+        HitTestGroup linearGroup;
+        HitTestGroup indexedGroup;
+        linearGroup.setSize(400, 400);
+        indexedGroup.setSize(400, 400);
+
+        REQUIRE(!indexedGroup.isSpatialIndexEnabled());
+        indexedGroup.setSpatialIndexEnabled(true);
+        REQUIRE(indexedGroup.isSpatialIndexEnabled());
+
+        // Both groups get the same overlapping widgets
+        for (auto* group : {&linearGroup, &indexedGroup})
+        {
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                auto button = tgui::Button::create();
+                button->setPosition((i % 10) * 38.f, (i / 10) * 38.f);
+                button->setSize(45, 45);
+                group->add(button);
+            }
+
+            group->getWidgets()[12]->setEnabled(false);
+            group->getWidgets()[25]->setVisible(false);
+
+            // A resizable child window can also be found outside its borders
+            auto childWindow = tgui::ChildWindow::create();
+            childWindow->setResizable(true);
+            childWindow->setPosition(200, 200);
+            childWindow->setSize(50, 50);
+            group->add(childWindow);
+        }
+
+        auto compareHitTests = [&]{
+            for (float x = -20; x < 420; x += 3)
+            {
+                for (float y = -20; y < 420; y += 3)
+                    REQUIRE(findWidgetIndex(indexedGroup, {x, y}) == findWidgetIndex(linearGroup, {x, y}));
+            }
+        };
+
+        compareHitTests();
+        REQUIRE(findWidgetIndex(indexedGroup, {1, 1}) == 0);
+        REQUIRE(findWidgetIndex(indexedGroup, {80, 40}) == -1);
+        REQUIRE(findWidgetIndex(indexedGroup, {500, 500}) == -1);
+
+        for (auto* group : {&linearGroup, &indexedGroup})
+        {
+            group->getWidgets()[5]->setPosition(100, 100);
+            group->getWidgets()[6]->setSize(100, 100);
+            group->getWidgets()[70]->setPosition(0, 0);
+        }
+        compareHitTests();
+
+        for (auto* group : {&linearGroup, &indexedGroup})
+        {
+            group->getWidgets()[99]->setPosition(450, 450);
+            group->getWidgets()[25]->setVisible(true);
+            group->moveWidgetToFront(group->getWidgets()[40]);
+            group->moveWidgetToBack(group->getWidgets()[80]);
+            group->remove(group->getWidgets()[50]);
+        }
+        compareHitTests();
+        REQUIRE(findWidgetIndex(indexedGroup, {460, 460}) == 97);
+        REQUIRE(findWidgetIndex(linearGroup, {460, 460}) == 97);
+
+        indexedGroup.setSpatialIndexEnabled(false);
+        compareHitTests();
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
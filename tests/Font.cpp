@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Widgets/Label.hpp>
 
 TEST_CASE("[Font]")
 {
@@ -36,3 +38,169 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
 }
+
+TEST_CASE("[Font] Glyph metrics cache")
+{
+    tgui::Font font("resources/DejaVuSans.ttf");
+    auto sfFont = font.getFont();
+
+    SECTION("Advance")
+    {
+        for (const std::uint32_t codePoint : {std::uint32_t('a'), std::uint32_t('W'), std::uint32_t(0x20AC), std::uint32_t(0x1F600)})
+        {
+            REQUIRE(font.getGlyphAdvance(codePoint, 20, false) == sfFont->getGlyph(codePoint, 20, false).advance);
+            REQUIRE(font.getGlyphAdvance(codePoint, 20, true) == sfFont->getGlyph(codePoint, 20, true).advance);
+            REQUIRE(font.getGlyphAdvance(codePoint, 12, false) == sfFont->getGlyph(codePoint, 12, false).advance);
+
+            // Second lookup is served from the cache
+            REQUIRE(font.getGlyphAdvance(codePoint, 20, false) == sfFont->getGlyph(codePoint, 20, false).advance);
+        }
+    }
+
+    SECTION("Kerning")
+    {
+        REQUIRE(font.getKerning('A', 'V', 20) == sfFont->getKerning('A', 'V', 20));
+        REQUIRE(font.getKerning('A', 'V', 20) == sfFont->getKerning('A', 'V', 20));
+        REQUIRE(font.getKerning('T', 'o', 30) == sfFont->getKerning('T', 'o', 30));
+        REQUIRE(font.getKerning(0, 'A', 20) == 0);
+        REQUIRE(tgui::Font().getKerning('A', 'V', 20) == 0);
+    }
+
+    SECTION("Copies share the cache")
+    {
+        const float advance = font.getGlyphAdvance('x', 16, false);
+        tgui::Font fontCopy = font;
+        REQUIRE(fontCopy.getGlyphAdvance('x', 16, false) == advance);
+        REQUIRE(fontCopy.getKerning('A', 'V', 16) == font.getKerning('A', 'V', 16));
+    }
+
+    SECTION("Fonts wrapping the same SFML font share the cache")
+    {
+        tgui::Font otherFont{sfFont};
+        font.getGlyphAdvance('y', 17, false);
+        REQUIRE(otherFont.getGlyphCacheStats().renderedGlyphs == font.getGlyphCacheStats().renderedGlyphs);
+
+        // Every call to getGlobalFont() constructs a new Font object
+        const tgui::Font globalFont = tgui::getGlobalFont();
+        globalFont.getGlyphAdvance(0x263A, 21, false);
+        const std::size_t renderedGlyphs = tgui::getGlobalFont().getGlyphCacheStats().renderedGlyphs;
+        REQUIRE(renderedGlyphs >= 1);
+
+        tgui::getGlobalFont().getGlyphAdvance(0x263A, 21, false);
+        REQUIRE(tgui::getGlobalFont().getGlyphCacheStats().renderedGlyphs == renderedGlyphs);
+        REQUIRE(globalFont.getGlyphCacheStats().renderedGlyphs == renderedGlyphs);
+    }
+}
+
+TEST_CASE("[Font] Glyph reference size")
+{
+    tgui::Font font("resources/DejaVuSans.ttf");
+    auto sfFont = font.getFont();
+
+    SECTION("Stats")
+    {
+        REQUIRE(font.getGlyphCacheStats().textureCount == 0);
+        REQUIRE(font.getGlyphCacheStats().renderedGlyphs == 0);
+
+        font.getGlyph('a', 20, false);
+        font.getGlyph('b', 20, false);
+        font.getGlyph('a', 20, false);
+        font.getGlyphAdvance('a', 30, false);
+
+        const auto stats = font.getGlyphCacheStats();
+        REQUIRE(stats.textureCount == 2);
+        REQUIRE(stats.renderedGlyphs == 3);
+        REQUIRE(stats.textureBytes == (sfFont->getTexture(20).getSize().x * sfFont->getTexture(20).getSize().y * 4)
+                                    + (sfFont->getTexture(30).getSize().x * sfFont->getTexture(30).getSize().y * 4));
+
+        REQUIRE(tgui::Font().getGlyphCacheStats().textureCount == 0);
+    }
+
+    SECTION("Scaled metrics")
+    {
+        REQUIRE(font.getGlyphReferenceSize() == 0);
+        REQUIRE(font.getGlyphScale(20) == 1);
+
+        font.setGlyphReferenceSize(40);
+        REQUIRE(font.getGlyphReferenceSize() == 40);
+        REQUIRE(font.getGlyphScale(20) == 0.5f);
+        REQUIRE(font.getGlyphScale(40) == 1);
+
+        const sf::Glyph& glyph = font.getGlyph('W', 20, false);
+        const sf::Glyph& referenceGlyph = sfFont->getGlyph('W', 40, false);
+        REQUIRE(glyph.advance == referenceGlyph.advance / 2);
+        REQUIRE(glyph.bounds.width == referenceGlyph.bounds.width / 2);
+        REQUIRE(glyph.bounds.top == referenceGlyph.bounds.top / 2);
+        REQUIRE(glyph.textureRect == referenceGlyph.textureRect);
+
+        REQUIRE(font.getGlyphAdvance('W', 10, false) == referenceGlyph.advance / 4);
+        REQUIRE(font.getKerning('A', 'V', 20) == sfFont->getKerning('A', 'V', 40) / 2);
+        REQUIRE(font.getLineSpacing(20) == sfFont->getLineSpacing(40) / 2);
+        REQUIRE(&font.getTexture(20) == &sfFont->getTexture(40));
+
+        // Copies of the font share the setting
+        tgui::Font fontCopy = font;
+        REQUIRE(fontCopy.getGlyphReferenceSize() == 40);
+    }
+
+    SECTION("Texture count is bounded")
+    {
+        font.setGlyphReferenceSize(64);
+
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setString("Hello World");
+        for (unsigned int size = 8; size <= 64; ++size)
+        {
+            text.setCharacterSize(size);
+            text.draw(target, {});
+            REQUIRE(text.findCharacterPos(5).x == Approx(font.getGlyphAdvance('H', size, false) + font.getGlyphAdvance('e', size, false)
+                                                       + 2 * font.getGlyphAdvance('l', size, false) + font.getGlyphAdvance('o', size, false)
+                                                       + font.getKerning('H', 'e', size) + font.getKerning('e', 'l', size)
+                                                       + font.getKerning('l', 'l', size) + font.getKerning('l', 'o', size)));
+        }
+
+        tgui::Text::findBestTextSize(font, 37.5f);
+
+        const auto stats = font.getGlyphCacheStats();
+        REQUIRE(stats.textureCount == 1);
+        REQUIRE(stats.renderedGlyphs == 10); // Characters of the text and the 'x' and 'g' that are used to measure the text
+    }
+}
+
+TEST_CASE("[Font] Glyph reference size of the global font")
+{
+    // The label shares the global font, which would otherwise be destroyed together with the temporary fonts below
+    auto label = tgui::Label::create();
+    label->setTextSize(59);
+    REQUIRE(tgui::getGlobalFont().getGlyphReferenceSize() == 0);
+
+    tgui::getGlobalFont().setGlyphReferenceSize(64);
+    REQUIRE(tgui::getGlobalFont().getGlyphReferenceSize() == 64);
+
+    // The text of the widget is positioned with the metrics of the reference size
+    label->setText("Hello");
+
+    const tgui::Font font = tgui::getGlobalFont();
+    const auto sfFont = font.getFont();
+    float textWidth = 0;
+    std::uint32_t prevChar = 0;
+    for (const char c : std::string("Hello"))
+    {
+        if (prevChar != 0)
+            textWidth += sfFont->getKerning(prevChar, static_cast<std::uint32_t>(c), 64) * 59.f / 64.f;
+
+        textWidth += sfFont->getGlyph(static_cast<std::uint32_t>(c), 64, false).advance * 59.f / 64.f;
+        prevChar = static_cast<std::uint32_t>(c);
+    }
+
+    const tgui::Borders borders = label->getSharedRenderer()->getBorders();
+    const tgui::Padding padding = label->getSharedRenderer()->getPadding();
+    REQUIRE(label->getSize().x == Approx(textWidth + 2 * tgui::Text::getExtraHorizontalPadding(font, 59)
+                                         + borders.getLeft() + borders.getRight() + padding.getLeft() + padding.getRight()));
+
+    tgui::getGlobalFont().setGlyphReferenceSize(0);
+}
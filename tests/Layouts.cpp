@@ -24,9 +24,13 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Grid.hpp>
+#include <TGUI/Widgets/HorizontalLayout.hpp>
 #include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/VerticalLayout.hpp>
 #include <TGUI/Gui.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Sleep.hpp>
 
 using namespace tgui::bind_functions;
 using tgui::Layout;
@@ -407,6 +411,264 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Parsed expressions")
+    {
+        SECTION("Identical strings")
+        {
+            // Layouts created from the same string share the parsed expression, but every layout binds its own widgets
+            auto panel1 = tgui::Panel::create({400, 300});
+            auto panel2 = tgui::Panel::create({200, 100});
+
+            auto button1 = tgui::Button::create();
+            button1->setSize({"min(50%, &.w - 50)", "&.h / 2 + 10"});
+            panel1->add(button1);
+
+            auto button2 = tgui::Button::create();
+            button2->setSize({"min(50%, &.w - 50)", "&.h / 2 + 10"});
+            panel2->add(button2);
+
+            REQUIRE(button1->getSize() == sf::Vector2f(200, 160));
+            REQUIRE(button2->getSize() == sf::Vector2f(100, 60));
+
+            panel1->setSize({600, 200});
+            REQUIRE(button1->getSize() == sf::Vector2f(300, 110));
+            REQUIRE(button2->getSize() == sf::Vector2f(100, 60));
+
+            REQUIRE(button1->getSizeLayout().toString() == "(min(50%, &.w - 50), (&.h / 2) + 10)");
+            REQUIRE(button2->getSizeLayout().toString() == button1->getSizeLayout().toString());
+        }
+
+        SECTION("Deeply nested expression")
+        {
+            std::string expression = "1";
+            for (unsigned int i = 0; i < 40; ++i)
+                expression = "1 + (" + expression + ")";
+
+            REQUIRE(Layout(expression).getValue() == 41);
+
+            auto panel = tgui::Panel::create({400, 300});
+            auto button = tgui::Button::create();
+            button->setSize({"&.w - (" + expression + ")", "(" + expression + ") * &.h / 300"});
+            panel->add(button);
+            REQUIRE(button->getSize() == sf::Vector2f(359, 41));
+
+            panel->setSize({500, 600});
+            REQUIRE(button->getSize() == sf::Vector2f(459, 82));
+        }
+
+        SECTION("Bound widget destroyed")
+        {
+            auto button1 = tgui::Button::create();
+            button1->setSize({100, 50});
+
+            auto button2 = tgui::Button::create();
+            button2->setPosition({bindWidth(button1) + 10, bindHeight(button1)});
+            REQUIRE(button2->getPosition() == sf::Vector2f(110, 50));
+
+            button1 = nullptr;
+            REQUIRE(button2->getPosition() == sf::Vector2f(10, 0));
+        }
+    }
+
+    SECTION("Deferred updates")
+    {
+        REQUIRE(!Layout::isDeferredUpdatesEnabled());
+        Layout::setDeferredUpdatesEnabled(true);
+        REQUIRE(Layout::isDeferredUpdatesEnabled());
+
+        SECTION("Each widget is only updated once")
+        {
+            auto panel = tgui::Panel::create({400, 300});
+
+            auto left = tgui::Panel::create({"&.w / 2", "&.h"});
+            panel->add(left);
+
+            auto right = tgui::Panel::create({"&.w / 4", "&.h / 2"});
+            panel->add(right);
+
+            auto bottom = tgui::Button::create();
+            bottom->setSize(bindWidth(left) + bindWidth(right), bindHeight(right));
+            panel->add(bottom);
+            REQUIRE(bottom->getSize() == sf::Vector2f(300, 150));
+
+            unsigned int sizeChangedCount = 0;
+            bottom->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+            // Widgets that depend on the panel aren't updated yet
+            panel->setSize({800, 600});
+            REQUIRE(left->getSize() == sf::Vector2f(200, 300));
+            REQUIRE(bottom->getSize() == sf::Vector2f(300, 150));
+
+            Layout::updateDeferredLayouts();
+            REQUIRE(left->getSize() == sf::Vector2f(400, 600));
+            REQUIRE(right->getSize() == sf::Vector2f(200, 300));
+            REQUIRE(bottom->getSize() == sf::Vector2f(600, 300));
+            REQUIRE(sizeChangedCount == 1);
+
+            // Without deferring, the bottom widget is resized for every change in the widgets it depends on
+            Layout::setDeferredUpdatesEnabled(false);
+            sizeChangedCount = 0;
+            panel->setSize({400, 300});
+            REQUIRE(bottom->getSize() == sf::Vector2f(300, 150));
+            REQUIRE(sizeChangedCount == 3);
+        }
+
+        SECTION("Disabling deferred updates")
+        {
+            auto panel = tgui::Panel::create({400, 300});
+            auto child = tgui::Panel::create({"50%", "50%"});
+            panel->add(child);
+
+            panel->setSize({800, 600});
+            REQUIRE(child->getSize() == sf::Vector2f(200, 150));
+
+            Layout::setDeferredUpdatesEnabled(false);
+            REQUIRE(child->getSize() == sf::Vector2f(400, 300));
+        }
+
+        SECTION("Widget destroyed before update")
+        {
+            auto panel = tgui::Panel::create({400, 300});
+            auto child = tgui::Panel::create({"50%", "50%"});
+            panel->add(child);
+
+            panel->setSize({800, 600});
+            panel->remove(child);
+            child = nullptr;
+            Layout::updateDeferredLayouts();
+        }
+
+        SECTION("Widget destroyed during update")
+        {
+            auto panel = tgui::Panel::create({400, 300});
+            auto child1 = tgui::Panel::create({"50%", "50%"});
+            auto child2 = tgui::Panel::create({"50%", "50%"});
+            panel->add(child1);
+            panel->add(child2);
+
+            // Whichever child is updated first destroys the other one, which then can no longer be updated
+            unsigned int sizeChangedCount = 0;
+            child1->connect("SizeChanged", [&]{ sizeChangedCount++; panel->remove(child2); child2 = nullptr; });
+            child2->connect("SizeChanged", [&]{ sizeChangedCount++; panel->remove(child1); child1 = nullptr; });
+
+            panel->setSize({800, 600});
+            Layout::updateDeferredLayouts();
+            REQUIRE(sizeChangedCount == 1);
+            REQUIRE(panel->getWidgets().size() == 1);
+            REQUIRE(panel->getWidgets()[0]->getSize() == sf::Vector2f(400, 300));
+        }
+
+        SECTION("Deferring is shared by all guis")
+        {
+            sf::RenderTexture target;
+            target.create(200, 100);
+            tgui::Gui gui1{target};
+            tgui::Gui gui2{target};
+
+            auto panel1 = tgui::Panel::create({"50%", "50%"});
+            gui1.add(panel1);
+            auto panel2 = tgui::Panel::create({"50%", "50%"});
+            gui2.add(panel2);
+
+            gui1.setView(sf::View{{0, 0, 400, 200}});
+            gui2.setView(sf::View{{0, 0, 400, 200}});
+            REQUIRE(panel1->getSize() == sf::Vector2f(100, 50));
+            REQUIRE(panel2->getSize() == sf::Vector2f(100, 50));
+
+            // Drawing one gui also updates the layouts of the widgets in the other gui
+            gui1.draw();
+            REQUIRE(panel1->getSize() == sf::Vector2f(200, 100));
+            REQUIRE(panel2->getSize() == sf::Vector2f(200, 100));
+        }
+
+        SECTION("Gui")
+        {
+            sf::RenderTexture target;
+            target.create(200, 100);
+            tgui::Gui gui{target};
+
+            auto panel = tgui::Panel::create({bindWidth(gui) / 2, bindHeight(gui)});
+            gui.add(panel);
+            REQUIRE(panel->getSize() == sf::Vector2f(100, 100));
+
+            gui.setView(sf::View{{0, 0, 400, 300}});
+            REQUIRE(panel->getSize() == sf::Vector2f(100, 100));
+
+            gui.updateLayouts();
+            REQUIRE(panel->getSize() == sf::Vector2f(200, 300));
+        }
+
+        SECTION("Animation")
+        {
+            sf::RenderTexture target;
+            target.create(200, 100);
+            tgui::Gui gui{target};
+
+            auto panel = tgui::Panel::create({100, 50});
+            gui.add(panel);
+            auto child = tgui::Panel::create({bindWidth(panel), bindHeight(panel)});
+            gui.add(child);
+            gui.updateLayouts();
+            REQUIRE(child->getSize() == sf::Vector2f(100, 50));
+
+            panel->showWithEffect(tgui::ShowAnimationType::Scale, sf::milliseconds(1));
+            gui.updateLayouts();
+            REQUIRE(child->getSize() == sf::Vector2f(0, 0));
+
+            // Layouts depending on the animated widget are updated in the same call that finishes the animation
+            sf::sleep(sf::milliseconds(10));
+            gui.updateTime();
+            REQUIRE(panel->getSize() == sf::Vector2f(100, 50));
+            REQUIRE(child->getSize() == sf::Vector2f(100, 50));
+        }
+
+        SECTION("Nested layouts give the same result")
+        {
+            auto createNestedLayouts = [](tgui::Panel::Ptr root)
+                {
+                    auto vertical = tgui::VerticalLayout::create();
+                    root->add(vertical);
+
+                    tgui::Widget::Ptr lastWidget;
+                    for (unsigned int i = 0; i < 3; ++i)
+                    {
+                        auto horizontal = tgui::HorizontalLayout::create();
+                        vertical->add(horizontal);
+
+                        for (unsigned int j = 0; j < 3; ++j)
+                        {
+                            auto grid = tgui::Grid::create();
+                            grid->setSize({"100%", "100%"});
+                            horizontal->add(grid);
+
+                            lastWidget = tgui::Button::create();
+                            lastWidget->setSize({"&.w / 2", "&.h / 3"});
+                            grid->addWidget(lastWidget, 0, 0);
+                        }
+                    }
+
+                    return lastWidget;
+                };
+
+            auto deferredRoot = tgui::Panel::create({300, 300});
+            auto deferredWidget = createNestedLayouts(deferredRoot);
+
+            Layout::setDeferredUpdatesEnabled(false);
+            auto immediateRoot = tgui::Panel::create({300, 300});
+            auto immediateWidget = createNestedLayouts(immediateRoot);
+            immediateRoot->setSize({600, 450});
+
+            Layout::setDeferredUpdatesEnabled(true);
+            deferredRoot->setSize({600, 450});
+            Layout::updateDeferredLayouts();
+
+            REQUIRE(deferredWidget->getSize() == immediateWidget->getSize());
+            REQUIRE(deferredWidget->getAbsolutePosition() == immediateWidget->getAbsolutePosition());
+        }
+
+        Layout::setDeferredUpdatesEnabled(false);
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
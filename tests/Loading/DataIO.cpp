@@ -204,6 +204,151 @@ TEST_CASE("[DataIO]")
             std::stringstream input("{ Property = ; ");
             REQUIRE_THROWS_AS(tgui::DataIO::parse(input), tgui::Exception);
         }
+
+        SECTION("Error position")
+        {
+            std::stringstream input("Child {\n    Property = Value;\n    Other ;\n}");
+            try
+            {
+                tgui::DataIO::parse(input);
+                REQUIRE(false);
+            }
+            catch (const tgui::Exception& e)
+            {
+                REQUIRE(std::string(e.what()) == "Error while parsing input at line 3, column 11. Expected '{' or '=', found ';' instead.");
+            }
+
+            const std::string str = "{ Property = ; ";
+            try
+            {
+                tgui::DataIO::parse(str.data(), str.size());
+                REQUIRE(false);
+            }
+            catch (const tgui::Exception& e)
+            {
+                REQUIRE(std::string(e.what()) == "Error while parsing input at line 1, column 14. Found empty value.");
+            }
+        }
+
+        SECTION("Parse from memory")
+        {
+            const std::string str = "Prop1 = \"a;b\"; // Comment\n"
+                                    "Child.\"Name\" { Prop2 = [1, \"x,y\", 3]; /* Comment */ Nested { Prop3 = 5 } };";
+            std::stringstream stream(str);
+            const auto rootFromStream = tgui::DataIO::parse(stream);
+            const auto root = tgui::DataIO::parse(str.data(), str.size());
+
+            REQUIRE(root->propertyValuePairs.size() == 1);
+            REQUIRE(root->propertyValuePairs["prop1"]->value == "\"a;b\"");
+            REQUIRE(root->children.size() == 1);
+            REQUIRE(root->children[0]->name == "Child.\"Name\"");
+            REQUIRE(root->children[0]->parent == root.get());
+            REQUIRE(root->children[0]->propertyValuePairs["prop2"]->listNode);
+            REQUIRE(root->children[0]->propertyValuePairs["prop2"]->valueList == std::vector<std::string>({"1", "\"x,y\"", "3"}));
+            REQUIRE(root->children[0]->children.size() == 1);
+            REQUIRE(root->children[0]->children[0]->propertyValuePairs["prop3"]->value == "5");
+
+            std::stringstream emitted1;
+            std::stringstream emitted2;
+            tgui::DataIO::emit(root, emitted1);
+            tgui::DataIO::emit(rootFromStream, emitted2);
+            REQUIRE(emitted1.str() == emitted2.str());
+
+            REQUIRE(tgui::DataIO::parse(str.data(), 0)->children.empty());
+        }
+    }
+
+    SECTION("Compiled format")
+    {
+        std::stringstream input("Prop1 = Value1;\n"
+                                "Renderer.1 { TextColor = Red; }\n"
+                                "Button.\"Name\" { Position = (10, 20); Items = [A, \"B, C\"]; Renderer = &1; Nested { X = 1; } }\n"
+                                "{}");
+        const auto root = tgui::DataIO::parse(input);
+
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(root, binaryStream);
+        const std::string binary = binaryStream.str();
+        REQUIRE(binary.substr(1, 4) == "TGUI");
+
+        SECTION("Same tree as text format")
+        {
+            const auto compiledRoot = tgui::DataIO::parse(binary.data(), binary.size());
+
+            std::stringstream emitted1;
+            std::stringstream emitted2;
+            tgui::DataIO::emit(root, emitted1);
+            tgui::DataIO::emit(compiledRoot, emitted2);
+            REQUIRE(emitted1.str() == emitted2.str());
+
+            REQUIRE(compiledRoot->parent == nullptr);
+            REQUIRE(compiledRoot->children.size() == 3);
+            REQUIRE(compiledRoot->children[1]->name == "Button.\"Name\"");
+            REQUIRE(compiledRoot->children[1]->parent == compiledRoot.get());
+            REQUIRE(compiledRoot->children[1]->children[0]->parent == compiledRoot->children[1].get());
+            REQUIRE(compiledRoot->children[1]->propertyValuePairs["items"]->listNode);
+            REQUIRE(compiledRoot->children[1]->propertyValuePairs["items"]->valueList == std::vector<std::string>({"A", "\"B, C\""}));
+            REQUIRE(!compiledRoot->children[1]->propertyValuePairs["position"]->listNode);
+            REQUIRE(compiledRoot->children[2]->name.empty());
+        }
+
+        SECTION("Parsing from stream")
+        {
+            std::stringstream stream(binary);
+            const auto compiledRoot = tgui::DataIO::parse(stream);
+            REQUIRE(compiledRoot->children.size() == 3);
+            REQUIRE(compiledRoot->propertyValuePairs["prop1"]->value == "Value1");
+        }
+
+        SECTION("Property names are stored in lowercase")
+        {
+            auto node = std::make_unique<tgui::DataIO::Node>();
+            node->propertyValuePairs["MixedCase"] = std::make_unique<tgui::DataIO::ValueNode>("[1, 2]");
+
+            std::stringstream stream;
+            tgui::DataIO::emitBinary(node, stream);
+            const auto compiledRoot = tgui::DataIO::parse(stream);
+            REQUIRE(compiledRoot->propertyValuePairs.size() == 1);
+            REQUIRE(compiledRoot->propertyValuePairs["mixedcase"]->listNode);
+            REQUIRE(compiledRoot->propertyValuePairs["mixedcase"]->valueList.size() == 2);
+        }
+
+        SECTION("Invalid data")
+        {
+            for (std::size_t size = 8; size < binary.size(); ++size)
+                REQUIRE_THROWS_AS(tgui::DataIO::parse(binary.data(), size), tgui::Exception);
+
+            std::string wrongVersion = binary;
+            wrongVersion[8] = 2;
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(wrongVersion.data(), wrongVersion.size()), tgui::Exception);
+
+            std::string extraData = binary + "x";
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(extraData.data(), extraData.size()), tgui::Exception);
+        }
+
+        SECTION("Nesting depth")
+        {
+            auto createNestedNodes = [](unsigned int depth){
+                auto node = std::make_unique<tgui::DataIO::Node>();
+                tgui::DataIO::Node* deepestNode = node.get();
+                for (unsigned int i = 0; i < depth; ++i)
+                {
+                    deepestNode->children.push_back(std::make_unique<tgui::DataIO::Node>());
+                    deepestNode->children.back()->parent = deepestNode;
+                    deepestNode = deepestNode->children.back().get();
+                }
+
+                std::stringstream stream;
+                tgui::DataIO::emitBinary(node, stream);
+                return stream.str();
+            };
+
+            const std::string allowedDepth = createNestedNodes(256);
+            REQUIRE_NOTHROW(tgui::DataIO::parse(allowedDepth.data(), allowedDepth.size()));
+
+            const std::string tooDeep = createNestedNodes(257);
+            REQUIRE_THROWS_AS(tgui::DataIO::parse(tooDeep.data(), tooDeep.size()), tgui::Exception);
+        }
     }
 
     SECTION("correct input")
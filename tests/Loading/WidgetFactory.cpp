@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChildWindow.hpp>
+
+TEST_CASE("[WidgetFactory]")
+{
+    SECTION("createFromPrototype")
+    {
+        SECTION("Default renderer")
+        {
+            auto widget1 = tgui::WidgetFactory::createFromPrototype("Button");
+            auto widget2 = tgui::WidgetFactory::createFromPrototype("button");
+            REQUIRE(widget1 != nullptr);
+            REQUIRE(widget2 != nullptr);
+            REQUIRE(widget1 != widget2);
+            REQUIRE(widget1->getWidgetType() == "Button");
+            REQUIRE(std::dynamic_pointer_cast<tgui::Button>(widget1) != nullptr);
+            REQUIRE(widget1->getSharedRenderer()->getData() == tgui::Button::create()->getSharedRenderer()->getData());
+            REQUIRE(widget2->getSharedRenderer()->getData() == widget1->getSharedRenderer()->getData());
+        }
+
+        SECTION("Custom renderer")
+        {
+            tgui::ChildWindowRenderer renderer;
+            renderer.setTitleBarHeight(25);
+            renderer.setBorders(2);
+            auto rendererData = renderer.getData();
+
+            auto window = tgui::ChildWindow::create();
+            window->setSize({100, 50});
+            window->setRenderer(rendererData);
+
+            auto widget1 = tgui::WidgetFactory::createFromPrototype("ChildWindow", rendererData);
+            auto widget2 = tgui::WidgetFactory::createFromPrototype("ChildWindow", rendererData);
+            REQUIRE(widget1->getSharedRenderer()->getData() == rendererData);
+            REQUIRE(widget2->getSharedRenderer()->getData() == rendererData);
+
+            // The cached renderer properties are copied from the prototype
+            widget1->setSize({100, 50});
+            REQUIRE(widget1->getFullSize() == window->getFullSize());
+            REQUIRE(widget1->getFullSize() == tgui::Vector2f{104, 79});
+
+            // Changing the renderer of one widget doesn't affect the others
+            widget1->getRenderer()->setOpacity(0.5f);
+            REQUIRE(widget1->getSharedRenderer()->getData() != rendererData);
+            REQUIRE(widget2->getSharedRenderer()->getOpacity() == 1);
+
+            // Changing the shared renderer changes all widgets, including the prototype that new widgets are copied from
+            renderer.setTitleBarHeight(30);
+            auto widget3 = tgui::WidgetFactory::createFromPrototype("ChildWindow", rendererData);
+            widget3->setSize({100, 50});
+            REQUIRE(widget3->getFullSize() == tgui::Vector2f{104, 84});
+        }
+
+        SECTION("Global text size")
+        {
+            const unsigned int oldTextSize = tgui::getGlobalTextSize();
+            REQUIRE(tgui::WidgetFactory::createFromPrototype("Button")->getTextSize() == oldTextSize);
+
+            tgui::setGlobalTextSize(oldTextSize + 5);
+            REQUIRE(tgui::WidgetFactory::createFromPrototype("Button")->getTextSize() == oldTextSize + 5);
+
+            tgui::setGlobalTextSize(oldTextSize);
+            REQUIRE(tgui::WidgetFactory::createFromPrototype("Button")->getTextSize() == oldTextSize);
+        }
+
+        SECTION("Construct function")
+        {
+            REQUIRE(tgui::WidgetFactory::createFromPrototype("UnknownWidgetType") == nullptr);
+
+            unsigned int constructCount = 0;
+            tgui::WidgetFactory::setConstructFunction("PrototypeTestWidget", [&]{ constructCount++; return tgui::Button::create("Test"); });
+            REQUIRE(std::static_pointer_cast<tgui::Button>(tgui::WidgetFactory::createFromPrototype("PrototypeTestWidget"))->getText() == "Test");
+            REQUIRE(std::static_pointer_cast<tgui::Button>(tgui::WidgetFactory::createFromPrototype("PrototypeTestWidget"))->getText() == "Test");
+            REQUIRE(constructCount == 1);
+
+            // Changing the construct function removes the prototype
+            tgui::WidgetFactory::setConstructFunction("PrototypeTestWidget", [&]{ constructCount++; return tgui::Button::create("Other"); });
+            REQUIRE(std::static_pointer_cast<tgui::Button>(tgui::WidgetFactory::createFromPrototype("PrototypeTestWidget"))->getText() == "Other");
+            REQUIRE(constructCount == 2);
+
+            tgui::WidgetFactory::clearPrototypes();
+            tgui::WidgetFactory::createFromPrototype("PrototypeTestWidget");
+            REQUIRE(constructCount == 3);
+
+            tgui::WidgetFactory::setConstructFunction("PrototypeTestWidget", nullptr);
+            REQUIRE(tgui::WidgetFactory::createFromPrototype("PrototypeTestWidget") == nullptr);
+        }
+
+        tgui::WidgetFactory::clearPrototypes();
+    }
+}
@@ -0,0 +1,341 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[Redraw]")
+{
+    sf::RenderTexture target;
+    target.create(200, 100);
+    tgui::Gui gui{target};
+
+    auto panel = tgui::Panel::create({100, 80});
+    panel->setPosition({10, 10});
+    gui.add(panel);
+
+    auto button = tgui::Button::create("Hello");
+    button->setPosition({20, 20});
+    button->setSize({40, 20});
+    panel->add(button);
+
+    // Everything has to be drawn the first time
+    REQUIRE(gui.needsRedraw());
+    gui.draw();
+    REQUIRE(!gui.needsRedraw());
+    REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{});
+
+    // Drawing again without changes doesn't change anything
+    gui.draw();
+    REQUIRE(!gui.needsRedraw());
+    REQUIRE(!gui.updateTime());
+
+    SECTION("Changing widget")
+    {
+        button->setText("World");
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{30, 30, 40, 20});
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        button->getRenderer()->setTextColor(sf::Color::Red);
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("Moving widget")
+    {
+        button->setPosition({50, 40});
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{30, 30, 70, 40});
+        gui.draw();
+
+        // Setting the same position again doesn't require a redraw
+        button->setPosition({50, 40});
+        REQUIRE(!gui.needsRedraw());
+    }
+
+    SECTION("Resizing widget")
+    {
+        button->setSize({30, 40});
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{30, 30, 40, 40});
+    }
+
+    SECTION("Hiding widget")
+    {
+        button->setVisible(false);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        // Changes to hidden widgets aren't visible
+        button->setText("World");
+        REQUIRE(!gui.needsRedraw());
+
+        panel->setVisible(false);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        button->setVisible(true);
+        REQUIRE(!gui.needsRedraw());
+    }
+
+    SECTION("Adding and removing widgets")
+    {
+        panel->add(tgui::Button::create());
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        panel->remove(button);
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{30, 30, 40, 20});
+        gui.draw();
+
+        // Changing a widget that is no longer part of the gui has no effect
+        button->setText("World");
+        REQUIRE(!gui.needsRedraw());
+
+        gui.removeAllWidgets();
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("Adding widgets in bulk")
+    {
+        auto button1 = tgui::Button::create();
+        button1->setPosition({5, 5});
+        button1->setSize({40, 20});
+        auto button2 = tgui::Button::create();
+        button2->setPosition({200, 200});
+        panel->addBulk({button1, button2});
+
+        // The whole panel is redrawn instead of the area of each added widget
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{10, 10, 100, 80});
+        gui.draw();
+
+        // Changes to widgets are drawn again afterwards
+        button1->setText("World");
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.getInvalidatedArea() == tgui::FloatRect{15, 15, 40, 20});
+    }
+
+    SECTION("Handling events")
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 150;
+        event.mouseMove.y = 90;
+        gui.handleEvent(event);
+        REQUIRE(!gui.needsRedraw());
+
+        event.mouseMove.x = 35;
+        event.mouseMove.y = 35;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+
+        // Moving the mouse over widgets doesn't require a redraw when they don't change
+        gui.draw();
+        event.mouseMove.x = 40;
+        gui.handleEvent(event);
+        REQUIRE(!gui.needsRedraw());
+
+        event.mouseMove.x = 15;
+        event.mouseMove.y = 15;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        event.mouseMove.x = 20;
+        gui.handleEvent(event);
+        REQUIRE(!gui.needsRedraw());
+    }
+
+    SECTION("Blinking caret")
+    {
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        gui.draw();
+
+        // The caret only blinks when the edit box is focused
+        gui.updateTime(sf::milliseconds(600));
+        REQUIRE(!gui.needsRedraw());
+
+        editBox->setFocused(true);
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+        gui.updateTime(sf::milliseconds(600));
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("Caching")
+    {
+        REQUIRE(!gui.isDrawCachingEnabled());
+        gui.setDrawCachingEnabled(true);
+        REQUIRE(gui.isDrawCachingEnabled());
+
+        // The widgets are drawn on the cache the first time, which is then drawn on the target
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+
+        // Only the cached frame is drawn when nothing changed
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == 1);
+
+        button->setText("World");
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+
+        gui.setDrawCachingEnabled(false);
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+    }
+}
+
+TEST_CASE("[Redraw] Internal state changes with caching")
+{
+    sf::RenderTexture target;
+    target.create(200, 100);
+    tgui::Gui gui{target};
+    gui.setDrawCachingEnabled(true);
+
+    sf::Event event;
+    event.type = sf::Event::MouseMoved;
+
+    SECTION("Button press")
+    {
+        auto button = tgui::Button::create("Hello");
+        button->setPosition({20, 20});
+        button->setSize({40, 20});
+        button->getRenderer()->setBackgroundColorDown(sf::Color::Red);
+        gui.add(button);
+
+        event.mouseMove.x = 30;
+        event.mouseMove.y = 30;
+        gui.handleEvent(event);
+        gui.draw();
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == 1);
+
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = 30;
+        event.mouseButton.y = 30;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+
+        event.type = sf::Event::MouseButtonReleased;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+    }
+
+    SECTION("ListBox hover change")
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({100, 80});
+        listBox->setItemHeight(20);
+        listBox->addItem("1");
+        listBox->addItem("2");
+        listBox->addItem("3");
+        gui.add(listBox);
+
+        event.mouseMove.x = 10;
+        event.mouseMove.y = 10;
+        gui.handleEvent(event);
+        gui.draw();
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == 1);
+
+        // Moving the mouse on the same item doesn't change anything
+        event.mouseMove.y = 15;
+        gui.handleEvent(event);
+        REQUIRE(!gui.needsRedraw());
+
+        event.mouseMove.y = 30;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+    }
+
+    SECTION("EditBox arrow key")
+    {
+        auto editBox = tgui::EditBox::create();
+        editBox->setSize({150, 30});
+        editBox->setText("Hello");
+        gui.add(editBox);
+        editBox->setFocused(true);
+        gui.draw();
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == 1);
+
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::Left;
+        event.key.alt = false;
+        event.key.control = false;
+        event.key.shift = false;
+        event.key.system = false;
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() > 1);
+    }
+}
+
+TEST_CASE("[Redraw] Draw with caching")
+{
+    auto panel = tgui::Panel::create({40, 30});
+    panel->setPosition(395, 305);
+    panel->getRenderer()->setBackgroundColor(sf::Color::Green);
+
+    auto clippedPanel = tgui::Panel::create({200, 200});
+    clippedPanel->setPosition(-50, -50);
+    clippedPanel->getRenderer()->setBackgroundColor({255, 0, 0, 100});
+    panel->add(clippedPanel);
+
+    TEST_DRAW_INIT(80, 80, panel)
+    gui.setDrawCachingEnabled(true);
+
+    auto background = tgui::Panel::create();
+    background->setSize({800, 600});
+    background->getRenderer()->setBackgroundColor(sf::Color::Blue);
+    gui.add(background);
+    background->moveToBack();
+
+    sf::View view = gui.getView();
+    view.setViewport({0.1f, 0.2f, 0.8f, 0.6f});
+    view.setCenter(415, 320);
+    view.setSize(80, 40);
+    gui.setView(view);
+
+    // The result has to be identical to drawing directly on the target, also when drawing the cached frame a second time
+    TEST_DRAW("Clipping_Panel.png")
+    REQUIRE(!gui.needsRedraw());
+    TEST_DRAW("Clipping_Panel.png")
+}
@@ -143,4 +143,70 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("emit")
+    {
+        SECTION("Handlers are called in the order in which they were connected")
+        {
+            std::string order;
+            widget->connect("PositionChanged", [&](){ order += "1"; });
+            widget->connect("PositionChanged", [&](){ order += "2"; });
+            widget->connect("PositionChanged", [&](){ order += "3"; });
+            widget->setPosition(10, 10);
+            REQUIRE(order == "123");
+        }
+
+        SECTION("Connecting and disconnecting while emitting")
+        {
+            // Changes made from within a handler only affect the next time the signal is emitted
+            std::string order;
+            unsigned int id2 = 0;
+            widget->connect("PositionChanged", [&](){
+                    order += "1";
+                    if (id2 != 0)
+                    {
+                        REQUIRE(widget->disconnect(id2));
+                        widget->connect("PositionChanged", [&](){ order += "3"; });
+                        id2 = 0;
+                    }
+                });
+            id2 = widget->connect("PositionChanged", [&](){ order += "2"; });
+
+            widget->setPosition(10, 10);
+            REQUIRE(order == "12");
+
+            order.clear();
+            widget->setPosition(20, 20);
+            REQUIRE(order == "13");
+
+            order.clear();
+            widget->connect("PositionChanged", [&](){ order += "4"; widget->disconnectAll("PositionChanged"); });
+            widget->connect("PositionChanged", [&](){ order += "5"; });
+            widget->setPosition(30, 30);
+            REQUIRE(order == "1345");
+
+            order.clear();
+            widget->setPosition(40, 40);
+            REQUIRE(order.empty());
+        }
+
+        SECTION("Emitting from within a handler")
+        {
+            // A signal emitted by a handler must not change the parameters passed to the remaining handlers
+            auto widget2 = tgui::ClickableWidget::create();
+            sf::Vector2f size;
+            widget2->connect("SizeChanged", [&](sf::Vector2f newSize){ size = newSize; });
+
+            std::vector<sf::Vector2f> positions;
+            widget->connect("PositionChanged", [&](sf::Vector2f pos){ positions.push_back(pos); widget2->setSize(pos.x * 2, pos.y * 2); });
+            widget->connect("PositionChanged", [&](sf::Vector2f pos){ positions.push_back(pos); });
+            widget->connect("PositionChanged", [&](tgui::Widget::Ptr w, std::string signalName){ REQUIRE(w == widget); REQUIRE(signalName == "PositionChanged"); });
+
+            widget->setPosition(10, 20);
+            REQUIRE(size == sf::Vector2f(20, 40));
+            REQUIRE(positions.size() == 2);
+            REQUIRE(positions[0] == sf::Vector2f(10, 20));
+            REQUIRE(positions[1] == sf::Vector2f(10, 20));
+        }
+    }
 }
@@ -144,6 +144,17 @@ void testSavingWidget(std::string name, std::shared_ptr<WidgetType> widget, bool
         REQUIRE_NOTHROW(parent->saveWidgetsToFile(name + "WidgetFile3.txt"));
         REQUIRE(compareFiles(name + "WidgetFile1.txt", name + "WidgetFile3.txt"));
     }
+
+    SECTION("Saving again after loading compiled file")
+    {
+        REQUIRE_NOTHROW(parent->saveWidgetsToBinaryFile(name + "WidgetFile.bin"));
+
+        parent = std::make_shared<tgui::GuiContainer>();
+        REQUIRE_NOTHROW(parent->loadWidgetsFromFile(name + "WidgetFile.bin"));
+
+        REQUIRE_NOTHROW(parent->saveWidgetsToFile(name + "WidgetFile4.txt"));
+        REQUIRE(compareFiles(name + "WidgetFile1.txt", name + "WidgetFile4.txt"));
+    }
 }
 
 #endif // TGUI_TESTS_HPP
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <TGUI/RenderBatch.hpp>
 
 TEST_CASE("[Text]")
 {
@@ -136,3 +137,68 @@ TEST_CASE("[Text]")
         }
     }
 }
+
+TEST_CASE("[Text] Draw with batching")
+{
+    sf::RenderTexture target;
+    target.create(200, 100);
+
+    tgui::Font font{"resources/DejaVuSans.ttf"};
+    std::vector<tgui::Text> texts(10);
+    for (std::size_t i = 0; i < texts.size(); ++i)
+    {
+        texts[i].setFont(font);
+        texts[i].setString("Cell " + tgui::to_string(i));
+        texts[i].setPosition(0, i * 10.f);
+    }
+
+    tgui::RenderBatch batch;
+
+    SECTION("Texts with the same font and size share a draw call")
+    {
+        batch.begin(target, true);
+        for (const auto& text : texts)
+            text.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 1);
+
+        // Changing the color doesn't require a separate draw call
+        texts[3].setColor(sf::Color::Red);
+        texts[5].setOpacity(0.5f);
+        batch.begin(target, true);
+        for (const auto& text : texts)
+            text.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 1);
+    }
+
+    SECTION("Each character size has its own texture")
+    {
+        texts[5].setCharacterSize(20);
+        batch.begin(target, true);
+        for (const auto& text : texts)
+            text.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 3);
+    }
+
+    SECTION("Without batching every text is drawn separately")
+    {
+        batch.begin(target, false);
+        for (const auto& text : texts)
+            text.draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == texts.size());
+    }
+
+    SECTION("Empty texts aren't drawn")
+    {
+        texts[0].setString("");
+        texts[1].setFont(nullptr);
+        batch.begin(target, false);
+        texts[0].draw(target, {});
+        texts[1].draw(target, {});
+        batch.end();
+        REQUIRE(batch.getDrawCallCount() == 0);
+    }
+}
@@ -26,6 +26,7 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
+#include <TGUI/TGUI.hpp>
 #include <SFML/System/Err.hpp>
 
 TEST_CASE("[TextureManager]")
@@ -52,4 +53,239 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    // Memory usage
+    {
+        REQUIRE(tgui::TextureManager::getMemoryUsage().count("resources/image.png") == 0);
+
+        tgui::Texture texture3{"resources/image.png"};
+        tgui::Texture texture4{"resources/image.png", {10, 10, 20, 10}};
+        tgui::Texture texture5 = texture4;
+
+        auto memoryUsage = tgui::TextureManager::getMemoryUsage();
+        REQUIRE(memoryUsage.count("resources/image.png") == 1);
+        REQUIRE(memoryUsage["resources/image.png"].imageBytes == 50 * 50 * 4);
+        REQUIRE(memoryUsage["resources/image.png"].textureBytes == (50 * 50 * 4) + (20 * 10 * 4));
+        REQUIRE(memoryUsage["resources/image.png"].textures == 2);
+        REQUIRE(memoryUsage["resources/image.png"].users == 3);
+
+        texture3 = {};
+        memoryUsage = tgui::TextureManager::getMemoryUsage();
+        REQUIRE(memoryUsage["resources/image.png"].imageBytes == 50 * 50 * 4);
+        REQUIRE(memoryUsage["resources/image.png"].textureBytes == 20 * 10 * 4);
+        REQUIRE(memoryUsage["resources/image.png"].textures == 1);
+        REQUIRE(memoryUsage["resources/image.png"].users == 2);
+    }
+
+    REQUIRE(tgui::TextureManager::getMemoryUsage().count("resources/image.png") == 0);
+
+    // Texture atlas
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+        tgui::Texture texture3{"resources/image.png", {0, 0, 20, 10}};
+        tgui::Texture texture4{"resources/image.png", {10, 10, 20, 10}};
+        tgui::Texture texture5{"resources/Texture1.png"};
+        tgui::Texture texture6{"resources/Black.png"};
+        tgui::Texture texture7{"resources/Black.png", {0, 0, 45, 50}};
+
+        // Parts of different images share the same texture
+        const auto atlasTexture = texture3.getData()->atlasTexture;
+        REQUIRE(atlasTexture != nullptr);
+        REQUIRE(texture4.getData()->atlasTexture == atlasTexture);
+        REQUIRE(texture5.getData()->atlasTexture == atlasTexture);
+        REQUIRE(texture7.getData()->atlasTexture == atlasTexture);
+        REQUIRE(texture3.getData()->texture.getSize() == sf::Vector2u{0, 0});
+
+        // Images that are too large get their own texture
+        REQUIRE(texture6.getData()->atlasTexture == nullptr);
+        REQUIRE(texture6.getData()->texture.getSize() == sf::Vector2u{284, 209});
+
+        // The images don't overlap and contain the correct pixels
+        REQUIRE(texture3.getImageSize() == tgui::Vector2f{20, 10});
+        REQUIRE(texture4.getImageSize() == tgui::Vector2f{20, 10});
+        REQUIRE(texture5.getImageSize() == tgui::Vector2f{50, 50});
+        REQUIRE(texture7.getMiddleRect() == sf::IntRect{0, 0, 45, 50});
+        const sf::IntRect rect3 = texture3.getData()->atlasRect;
+        const sf::IntRect rect4 = texture4.getData()->atlasRect;
+        const sf::IntRect rect5 = texture5.getData()->atlasRect;
+        REQUIRE(!rect3.intersects(rect4));
+        REQUIRE(!rect3.intersects(rect5));
+        REQUIRE(!rect4.intersects(rect5));
+
+        const sf::Image atlasImage = atlasTexture->copyToImage();
+        const sf::Image& image = *texture4.getData()->image;
+        for (unsigned int x = 0; x < 20; ++x)
+        {
+            for (unsigned int y = 0; y < 10; ++y)
+            {
+                REQUIRE(atlasImage.getPixel(rect3.left + x, rect3.top + y) == image.getPixel(x, y));
+                REQUIRE(atlasImage.getPixel(rect4.left + x, rect4.top + y) == image.getPixel(10 + x, 10 + y));
+            }
+        }
+
+        auto memoryUsage = tgui::TextureManager::getMemoryUsage();
+        REQUIRE(memoryUsage["resources/image.png"].textureBytes == 2 * 20 * 10 * 4);
+
+        // Smooth images are moved out of the atlas
+        REQUIRE(!texture4.isSmooth());
+        texture4.setSmooth(false);
+        REQUIRE(texture4.getData()->atlasTexture == atlasTexture);
+        texture4.setSmooth(true);
+        REQUIRE(texture4.isSmooth());
+        REQUIRE(texture4.getData()->atlasTexture == nullptr);
+        REQUIRE(texture4.getImageSize() == tgui::Vector2f{20, 10});
+        REQUIRE(texture4.getData()->texture.copyToImage().getPixel(0, 0) == image.getPixel(10, 10));
+
+        // Sprites that share the image with the smooth texture still draw it from the atlas
+        {
+            tgui::Sprite sprite1{texture3};
+            tgui::Sprite sprite2{texture3};
+            REQUIRE(sprite1.getTexture().getData() == sprite2.getTexture().getData());
+
+            tgui::Texture smoothTexture = texture3;
+            smoothTexture.setSmooth(true);
+            sprite1.setTexture(smoothTexture);
+            REQUIRE(sprite1.getTexture().getData()->atlasTexture == nullptr);
+            REQUIRE(sprite2.getTexture().getData()->atlasTexture == atlasTexture);
+            REQUIRE(texture3.getData()->atlasTexture == atlasTexture);
+            REQUIRE(texture3.getData()->atlasRect == rect3);
+
+            sf::RenderTexture target;
+            target.create(20, 20);
+            target.clear(sf::Color::Transparent);
+            sprite2.setPosition({0, 10});
+            sprite1.draw(target, sf::RenderStates{sf::BlendNone});
+            sprite2.draw(target, sf::RenderStates{sf::BlendNone});
+            target.display();
+
+            const sf::Image targetImage = target.getTexture().copyToImage();
+            for (unsigned int x = 0; x < 20; ++x)
+            {
+                for (unsigned int y = 0; y < 10; ++y)
+                {
+                    REQUIRE(targetImage.getPixel(x, y) == image.getPixel(x, y));
+                    REQUIRE(targetImage.getPixel(x, 10 + y) == image.getPixel(x, y));
+                }
+            }
+        }
+
+        // The atlas is reused once all its images are gone
+        texture3 = {};
+        texture5 = {};
+        texture7 = {};
+        tgui::Texture texture8{"resources/Texture2.png"};
+        REQUIRE(texture8.getData()->atlasTexture != nullptr);
+        REQUIRE(texture8.getData()->atlasRect == sf::IntRect{0, 0, 50, 50});
+
+        tgui::TextureManager::setAtlasEnabled(false);
+        tgui::Texture texture9{"resources/Texture3.png"};
+        REQUIRE(texture9.getData()->atlasTexture == nullptr);
+    }
+
+    // Image retention
+    {
+        REQUIRE(tgui::TextureManager::getImageRetention() == tgui::TextureManager::ImageRetention::Image);
+        tgui::TextureManager::setImageRetention(tgui::TextureManager::ImageRetention::AlphaMask);
+        REQUIRE(tgui::TextureManager::getImageRetention() == tgui::TextureManager::ImageRetention::AlphaMask);
+
+        tgui::Texture texture3{"resources/TransparentParts.png"};
+        tgui::Texture texture4{"resources/TransparentParts.png", {10, 5, 30, 40}};
+        REQUIRE(texture3.getData()->image == nullptr);
+        REQUIRE(texture3.getData()->alphaMask != nullptr);
+        REQUIRE(texture4.getData()->alphaMask == texture3.getData()->alphaMask);
+
+        // All parts of the image share a texture that contains the entire image
+        REQUIRE(texture3.getData()->atlasTexture != nullptr);
+        REQUIRE(texture4.getData()->atlasTexture == texture3.getData()->atlasTexture);
+        REQUIRE(texture4.getData()->atlasRect == sf::IntRect{10, 5, 30, 40});
+        REQUIRE(texture4.getImageSize() == tgui::Vector2f{30, 40});
+
+        // The alpha mask gives the same results as the image
+        sf::Image image;
+        REQUIRE(image.loadFromFile("resources/TransparentParts.png"));
+        for (unsigned int x = 0; x < 50; ++x)
+        {
+            for (unsigned int y = 0; y < 50; ++y)
+            {
+                REQUIRE(texture3.isTransparentPixel({x, y}) == (image.getPixel(x, y).a == 0));
+                if ((x < 30) && (y < 40))
+                    REQUIRE(texture4.isTransparentPixel({x, y}) == (image.getPixel(10 + x, 5 + y).a == 0));
+            }
+        }
+
+        auto memoryUsage = tgui::TextureManager::getMemoryUsage();
+        REQUIRE(memoryUsage["resources/TransparentParts.png"].imageBytes == 0);
+        REQUIRE(memoryUsage["resources/TransparentParts.png"].alphaMaskBytes == (50 * 50 + 7) / 8);
+        REQUIRE(memoryUsage["resources/TransparentParts.png"].textureBytes == 50 * 50 * 4);
+
+        tgui::TextureManager::setImageRetention(tgui::TextureManager::ImageRetention::None);
+        tgui::Texture texture5{"resources/Texture4.png"};
+        REQUIRE(texture5.getData()->image == nullptr);
+        REQUIRE(texture5.getData()->alphaMask == nullptr);
+        REQUIRE(!texture5.isTransparentPixel({0, 0}));
+
+        tgui::TextureManager::setImageRetention(tgui::TextureManager::ImageRetention::Image);
+    }
+
+    // Memory used by the bundled themes
+    {
+        // Creates a widget for every section in the theme and returns the memory used by the textures of the theme
+        auto loadTheme = [](const std::string& filename, std::initializer_list<const char*> sections) {
+            tgui::Theme theme{filename};
+            std::vector<tgui::Widget::Ptr> widgets;
+            for (const auto& section : sections)
+            {
+                const std::string type = tgui::toLower(section);
+                widgets.push_back(tgui::WidgetFactory::getConstructFunction((type == "tooltip") ? "label" : type)());
+                widgets.back()->setRenderer(theme.getRenderer(section));
+            }
+
+            return tgui::TextureManager::getMemoryUsage();
+        };
+
+        for (const auto retention : {tgui::TextureManager::ImageRetention::Image,
+                                     tgui::TextureManager::ImageRetention::AlphaMask,
+                                     tgui::TextureManager::ImageRetention::None})
+        {
+            tgui::TextureManager::setImageRetention(retention);
+
+            auto blackUsage = loadTheme("resources/Black.txt", {"Button", "ChatBox", "Checkbox", "ChildWindow", "ComboBox", "EditBox",
+                "Label", "ListBox", "ListView", "MenuBar", "MessageBox", "Panel", "ProgressBar", "RadioButton", "Scrollbar", "Slider",
+                "SpinButton", "Tabs", "TextBox", "ToolTip"})["resources/Black.png"];
+            auto babyBlueUsage = loadTheme("resources/BabyBlue.txt", {"Button", "ChatBox", "CheckBox", "ChildWindow", "ComboBox",
+                "EditBox", "Label", "ListBox", "MenuBar", "MessageBox", "Panel", "ProgressBar", "RadioButton", "Scrollbar", "Slider",
+                "SpinButton", "Tabs", "TextBox", "Tooltip"})["resources/BabyBlue.png"];
+
+            switch (retention)
+            {
+            case tgui::TextureManager::ImageRetention::Image:
+                REQUIRE(blackUsage.imageBytes == 284 * 209 * 4);
+                REQUIRE(babyBlueUsage.imageBytes == 496 * 117 * 4);
+                REQUIRE(blackUsage.alphaMaskBytes == 0);
+                break;
+            case tgui::TextureManager::ImageRetention::AlphaMask:
+                REQUIRE(blackUsage.imageBytes == 0);
+                REQUIRE(babyBlueUsage.imageBytes == 0);
+                REQUIRE(blackUsage.alphaMaskBytes == (284 * 209 + 7) / 8);
+                REQUIRE(babyBlueUsage.alphaMaskBytes == (496 * 117 + 7) / 8);
+                break;
+            case tgui::TextureManager::ImageRetention::None:
+                REQUIRE(blackUsage.imageBytes == 0);
+                REQUIRE(blackUsage.alphaMaskBytes == 0);
+                break;
+            }
+
+            // When the image isn't kept, a single texture contains the entire image
+            if (retention != tgui::TextureManager::ImageRetention::Image)
+            {
+                REQUIRE(blackUsage.textureBytes == 284 * 209 * 4);
+                REQUIRE(babyBlueUsage.textureBytes == 496 * 117 * 4);
+            }
+        }
+
+        tgui::TextureManager::setImageRetention(tgui::TextureManager::ImageRetention::Image);
+    }
 }
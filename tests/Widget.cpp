@@ -311,6 +311,56 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer != renderer->getData());
             REQUIRE(clonedRenderer->propertyValuePairs["opacity"].getNumber() == 0.5f);
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
+
+            // Changing the clone doesn't affect the original renderer
+            clonedRenderer->propertyValuePairs["opacity"] = 0.2f;
+            REQUIRE(tgui::WidgetRenderer{clonedRenderer}.getOpacity() == 0.2f);
+            REQUIRE(renderer->getOpacity() == 0.5f);
+        }
+
+        SECTION("Property ids")
+        {
+            const tgui::RendererPropertyId opacityId = tgui::getRendererPropertyId("opacity");
+            REQUIRE(tgui::getRendererPropertyId("opacity") == opacityId);
+            REQUIRE(tgui::getRendererPropertyId("opacitydisabled") != opacityId);
+            REQUIRE(tgui::getRendererPropertyName(opacityId) == "opacity");
+
+            auto data = renderer->getData();
+            REQUIRE(data->findProperty(opacityId) == nullptr);
+
+            renderer->setProperty(opacityId, 0.5f);
+            REQUIRE(data->findProperty(opacityId) != nullptr);
+            REQUIRE(data->findProperty(opacityId)->getNumber() == 0.5f);
+            REQUIRE(renderer->getProperty("Opacity").getNumber() == 0.5f);
+
+            // Properties can still be changed directly in the property-value pairs
+            data->propertyValuePairs["opacity"] = 0.8f;
+            REQUIRE(renderer->getOpacity() == 0.8f);
+
+            data->propertyValuePairs.erase("opacity");
+            data->invalidatePropertySlots();
+            REQUIRE(data->findProperty(opacityId) == nullptr);
+            REQUIRE(renderer->getOpacity() == 1.f);
+
+            data->propertyValuePairs.insert({"opacity", 0.4f});
+            REQUIRE(renderer->getOpacity() == 0.4f);
+
+            data->propertyValuePairs = std::map<std::string, tgui::ObjectConverter>{{"opacitydisabled", 0.3f}};
+            data->invalidatePropertySlots();
+            REQUIRE(renderer->getOpacity() == 1.f);
+            REQUIRE(renderer->getOpacityDisabled() == 0.3f);
+
+            data->propertyValuePairs.clear();
+            data->invalidatePropertySlots();
+            REQUIRE(renderer->getOpacityDisabled() == -1.f);
+
+            // A copy doesn't share the slots of the original
+            data->propertyValuePairs["opacity"] = 0.6f;
+            REQUIRE(renderer->getOpacity() == 0.6f);
+            auto copiedData = std::make_shared<tgui::RendererData>(*data);
+            data->propertyValuePairs.clear();
+            data->invalidatePropertySlots();
+            REQUIRE(tgui::WidgetRenderer{copiedData}.getOpacity() == 0.6f);
         }
 
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
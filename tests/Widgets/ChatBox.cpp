@@ -135,6 +135,63 @@ TEST_CASE("[ChatBox]")
         }
     }
 
+    SECTION("Streaming lines")
+    {
+        chatBox->setSize(150, 100);
+        chatBox->setTextSize(14);
+        chatBox->setLineLimit(500);
+
+        // The text height must be the same as when only the remaining lines were added.
+        // Scrolling past the end puts the scrollbar at its maximum, which depends on the text height.
+        auto checkTextHeight = [&]{
+            auto chatBox2 = tgui::ChatBox::copy(chatBox);
+            chatBox2->removeAllLines();
+            for (std::size_t i = 0; i < chatBox->getLineAmount(); ++i)
+                chatBox2->addLine(chatBox->getLine(i));
+
+            chatBox->setScrollbarValue(std::numeric_limits<unsigned int>::max());
+            chatBox2->setScrollbarValue(std::numeric_limits<unsigned int>::max());
+            REQUIRE(chatBox->getScrollbarValue() == chatBox2->getScrollbarValue());
+        };
+
+        SECTION("Oldest on top")
+        {
+            // Add lines in batches like they would arrive in between frames
+            for (unsigned int frame = 0; frame < 10; ++frame)
+            {
+                for (unsigned int i = 0; i < 1000; ++i)
+                    chatBox->addLine("Line " + tgui::to_string(frame * 1000 + i) + ((i % 7 == 0) ? " which is long enough to be wrapped" : ""));
+            }
+
+            REQUIRE(chatBox->getLineAmount() == 500);
+            REQUIRE(chatBox->getLine(499) == "Line 9999");
+            REQUIRE(chatBox->getScrollbarValue() > 0);
+            checkTextHeight();
+
+            REQUIRE(chatBox->removeLine(250));
+            REQUIRE(chatBox->removeLine(0));
+            REQUIRE(chatBox->removeLine(chatBox->getLineAmount() - 1));
+            checkTextHeight();
+
+            chatBox->setSize(200, 100);
+            checkTextHeight();
+        }
+
+        SECTION("Oldest at the bottom")
+        {
+            chatBox->setNewLinesBelowOthers(false);
+            for (unsigned int i = 0; i < 2000; ++i)
+                chatBox->addLine("Line " + tgui::to_string(i) + ((i % 7 == 0) ? " which is long enough to be wrapped" : ""));
+
+            REQUIRE(chatBox->getLineAmount() == 500);
+            REQUIRE(chatBox->getLine(0) == "Line 1999");
+            checkTextHeight();
+
+            REQUIRE(chatBox->removeLine(100));
+            checkTextHeight();
+        }
+    }
+
     SECTION("Text size")
     {
         chatBox->setTextSize(30);
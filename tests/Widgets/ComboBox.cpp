@@ -216,6 +216,26 @@ TEST_CASE("[ComboBox]")
         REQUIRE(!comboBox->contains("Item 1"));
         REQUIRE(!comboBox->containsId("1"));
     }
+
+    SECTION("Item indexing and filter")
+    {
+        comboBox->setItemIndexingEnabled(true);
+        REQUIRE(comboBox->isItemIndexingEnabled());
+
+        comboBox->addItem("Item 1", "1");
+        comboBox->addItem("Item 2", "2");
+        comboBox->addItem("Other", "3");
+        REQUIRE(comboBox->containsId("2"));
+        REQUIRE(comboBox->removeItemById("2"));
+        REQUIRE(!comboBox->containsId("2"));
+        REQUIRE(comboBox->setSelectedItemById("3"));
+        REQUIRE(comboBox->getSelectedItem() == "Other");
+
+        comboBox->setItemFilter("item");
+        REQUIRE(comboBox->getItemFilter() == "item");
+        REQUIRE(comboBox->getItemCount() == 2);
+        REQUIRE(comboBox->getSelectedItem() == "Other");
+    }
     
     SECTION("ItemsToDisplay")
     {
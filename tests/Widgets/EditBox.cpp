@@ -337,6 +337,84 @@ TEST_CASE("[EditBox]")
             REQUIRE(!editBox->setInputValidator("abc[0-"));
             REQUIRE(editBox->getInputValidator() == "abc[0-9]xyz");
         }
+
+        SECTION("Predefined validators behave like their regex")
+        {
+            // Every text of up to 3 characters is tried with every possible selection and typed character
+            const std::string alphabet = "+-.5x";
+            std::vector<std::string> texts = {""};
+            for (std::size_t i = 0; i < texts.size(); ++i)
+            {
+                if (texts[i].size() < 3)
+                {
+                    for (const char c : alphabet)
+                        texts.push_back(texts[i] + c);
+                }
+            }
+
+            for (const auto& validator : {tgui::EditBox::Validator::Int, tgui::EditBox::Validator::UInt, tgui::EditBox::Validator::Float})
+            {
+                const std::regex regex{validator};
+                editBox->setInputValidator(validator);
+
+                for (const auto& text : texts)
+                {
+                    editBox->setText(text);
+                    REQUIRE((editBox->getText() == text) == std::regex_match(text, regex));
+                    if (editBox->getText() != text)
+                        continue;
+
+                    for (std::size_t start = 0; start <= text.size(); ++start)
+                    {
+                        for (std::size_t length = 0; start + length <= text.size(); ++length)
+                        {
+                            for (const char c : alphabet)
+                            {
+                                editBox->setText(text);
+                                editBox->selectText(start, length);
+                                if (length == 0)
+                                    editBox->setCaretPosition(start);
+
+                                std::string expected = text;
+                                expected.replace(start, length, 1, c);
+                                if (!std::regex_match(expected, regex))
+                                    expected = text;
+
+                                editBox->textEntered(c);
+                                REQUIRE(editBox->getText() == expected);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        SECTION("Function")
+        {
+            editBox->setInputValidatorFunction([](const sf::String& text){ return text.getSize() <= 3; });
+            REQUIRE(editBox->getInputValidator() == "");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText(L"\u00CAb");
+            REQUIRE(editBox->getText() == L"\u00CAb");
+
+            editBox->textEntered('c');
+            REQUIRE(editBox->getText() == L"\u00CAbc");
+            editBox->textEntered('d');
+            REQUIRE(editBox->getText() == L"\u00CAbc");
+
+            editBox->selectText(1, 2);
+            editBox->textEntered('d');
+            REQUIRE(editBox->getText() == L"\u00CAd");
+
+            editBox->setText("abcd");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setInputValidatorFunction(nullptr);
+            REQUIRE(editBox->getInputValidator() == tgui::EditBox::Validator::All);
+            editBox->setText("abcd");
+            REQUIRE(editBox->getText() == "abcd");
+        }
     }
 
     SECTION("Events / Signals")
@@ -76,6 +76,24 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(1, 5) == nullptr);
     }
 
+    SECTION("Postponed updates")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+
+        grid->beginUpdate();
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 1, 1);
+        widget2->setSize({30, 20});
+        REQUIRE(grid->getSize() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(0, 0));
+
+        grid->endUpdate();
+        REQUIRE(grid->getSize() == sf::Vector2f(130, 70));
+        REQUIRE(widget1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == sf::Vector2f(100, 50));
+    }
+
     SECTION("Borders")
     {
         auto widget = tgui::ClickableWidget::create({40, 30});
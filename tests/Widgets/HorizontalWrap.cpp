@@ -94,6 +94,28 @@ TEST_CASE("[HorizontalWrap]")
         REQUIRE(pic8->getPosition() == sf::Vector2f(0, 160));
     }
 
+    SECTION("Postponed updates")
+    {
+        auto pic1 = tgui::Picture::create("resources/image.png");
+        auto pic2 = tgui::Picture::create("resources/image.png");
+        auto pic3 = tgui::Picture::create("resources/image.png");
+        pic1->setSize({50, 40});
+        pic2->setSize({50, 40});
+        pic3->setSize({50, 40});
+
+        wrap->beginUpdate();
+        wrap->add(pic1);
+        wrap->add(pic2);
+        wrap->add(pic3);
+        REQUIRE(pic2->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pic3->getPosition() == sf::Vector2f(0, 0));
+
+        wrap->endUpdate();
+        REQUIRE(pic1->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(pic2->getPosition() == sf::Vector2f(50, 0));
+        REQUIRE(pic3->getPosition() == sf::Vector2f(0, 40));
+    }
+
     testWidgetRenderer(wrap->getRenderer());
     SECTION("Renderer")
     {
@@ -289,6 +289,113 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getAutoScroll());
     }
 
+    SECTION("Item indexing")
+    {
+        REQUIRE(!listBox->isItemIndexingEnabled());
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+        listBox->setItemIndexingEnabled(true);
+        REQUIRE(listBox->isItemIndexingEnabled());
+
+        REQUIRE(listBox->contains("Item 2"));
+        REQUIRE(listBox->containsId("1"));
+        REQUIRE(!listBox->contains("Item 3"));
+
+        // Items added after the index was built are found
+        listBox->addItem("Item 3", "3");
+        listBox->addItem("Item 1", "4");
+        REQUIRE(listBox->containsId("3"));
+        REQUIRE(listBox->getItemById("3") == "Item 3");
+
+        // Duplicate items refer to the first one, like without indexing
+        REQUIRE(listBox->setSelectedItem("Item 1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        // Indices stay correct after removing and changing items
+        REQUIRE(listBox->removeItemById("1"));
+        REQUIRE(listBox->setSelectedItem("Item 1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+        REQUIRE(listBox->getSelectedItemId() == "4");
+
+        REQUIRE(listBox->changeItemById("2", "Item 5"));
+        REQUIRE(!listBox->contains("Item 2"));
+        REQUIRE(listBox->setSelectedItem("Item 5"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        listBox->setMaximumItems(2);
+        REQUIRE(!listBox->containsId("4"));
+        REQUIRE(listBox->containsId("3"));
+
+        listBox->removeAllItems();
+        REQUIRE(!listBox->containsId("3"));
+        listBox->addItem("Item 6", "6");
+        REQUIRE(listBox->containsId("6"));
+
+        listBox->setItemIndexingEnabled(false);
+        REQUIRE(listBox->containsId("6"));
+    }
+
+    SECTION("Item filter")
+    {
+        listBox->addItem("Apple");
+        listBox->addItem("Banana");
+        listBox->addItem("Pineapple");
+        listBox->addItem("Grape");
+        REQUIRE(listBox->getItemFilter() == "");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+
+        listBox->setItemFilter("ap");
+        REQUIRE(listBox->getItemFilter() == "ap");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+
+        listBox->setItemFilter("app");
+        REQUIRE(listBox->getFilteredItemCount() == 2);
+
+        listBox->setItemFilter("a");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+
+        listBox->setItemFilter("APPLE");
+        REQUIRE(listBox->getFilteredItemCount() == 2);
+
+        // Hidden items still exist
+        REQUIRE(listBox->getItemCount() == 4);
+        REQUIRE(listBox->setSelectedItem("Grape"));
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+
+        // Added, changed and removed items are filtered as well
+        listBox->addItem("Snapple");
+        listBox->addItem("Cherry");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+        listBox->changeItem("Cherry", "Crabapple");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+        listBox->changeItem("Apple", "Pear");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+        listBox->removeItem("Pear");
+        REQUIRE(listBox->getFilteredItemCount() == 3);
+        listBox->removeItem("Pineapple");
+        REQUIRE(listBox->getFilteredItemCount() == 2);
+
+        // Clicking selects the shown items
+        auto container = tgui::Group::create({400.f, 300.f});
+        container->add(listBox);
+        listBox->setSize(120, 100);
+        listBox->setItemHeight(20);
+        listBox->getRenderer()->setBorders(0);
+        listBox->getRenderer()->setPadding(0);
+
+        sf::Event event;
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = 10;
+        event.mouseButton.y = 30;
+        container->handleEvent(event);
+        REQUIRE(listBox->getSelectedItem() == "Crabapple");
+
+        listBox->setItemFilter("");
+        REQUIRE(listBox->getFilteredItemCount() == 4);
+        REQUIRE(listBox->getSelectedItem() == "Crabapple");
+    }
+
     SECTION("Events / Signals")
     {
         auto container = tgui::Group::create({400.f, 300.f});
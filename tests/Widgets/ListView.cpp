@@ -282,6 +282,78 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ });
     }
 
+    SECTION("Virtual items")
+    {
+        listView->setSize(200, 100);
+        listView->setItemHeight(20);
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem("Removed");
+
+        std::size_t requestedCells = 0;
+        auto cellGetter = [&](std::size_t row, std::size_t column){
+            ++requestedCells;
+            return std::to_string(row) + "," + std::to_string(column);
+        };
+
+        REQUIRE(!listView->isVirtual());
+        listView->setVirtualItems(5000000, cellGetter);
+        REQUIRE(listView->isVirtual());
+        REQUIRE(listView->getItemCount() == 5000000);
+        REQUIRE(listView->getItemRow(4999999) == std::vector<sf::String>{"4999999,0", "4999999,1"});
+        REQUIRE(listView->getItemCell(123, 1) == "123,1");
+        REQUIRE(listView->getItemCell(5000000, 0) == "");
+        REQUIRE(listView->getItem(7) == "7,0");
+
+        // Only the items near the visible area are loaded
+        REQUIRE(requestedCells > 0);
+        REQUIRE(requestedCells < 100);
+
+        requestedCells = 0;
+        listView->setVerticalScrollbarValue(2000000 * 20);
+        REQUIRE(requestedCells > 0);
+        REQUIRE(requestedCells < 100);
+
+        requestedCells = 0;
+        listView->setSelectedItem(3000000);
+        REQUIRE(listView->getSelectedItemIndex() == 3000000);
+        REQUIRE(requestedCells > 0);
+        REQUIRE(requestedCells < 100);
+
+        // Scrolling a single item only loads that item
+        requestedCells = 0;
+        listView->setVerticalScrollbarValue(listView->getVerticalScrollbarValue() + 20);
+        REQUIRE(requestedCells == 2);
+
+        // Items can't be changed directly
+        REQUIRE(listView->getItemCount() == 5000000);
+        REQUIRE(!listView->changeItem(0, {"Changed"}));
+        REQUIRE(!listView->removeItem(0));
+        REQUIRE(listView->getItemCell(0, 0) == "0,0");
+
+        // Selected items that disappear are deselected
+        listView->setVirtualItemCount(100);
+        REQUIRE(listView->getItemCount() == 100);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getItems().size() == 100);
+        REQUIRE(listView->getItemRows().size() == 100);
+
+        listView->setSelectedItem(99);
+        REQUIRE(listView->getSelectedItemIndex() == 99);
+
+        requestedCells = 0;
+        listView->reloadVirtualItems();
+        REQUIRE(requestedCells > 0);
+        REQUIRE(requestedCells < 100);
+
+        listView->removeAllItems();
+        REQUIRE(!listView->isVirtual());
+        REQUIRE(listView->getItemCount() == 0);
+
+        listView->addItem("Item");
+        REQUIRE(listView->getItemCount() == 1);
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <algorithm>
 
 TEST_CASE("[TextBox]")
 {
@@ -449,6 +450,60 @@ TEST_CASE("[TextBox]")
             REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
 
+        SECTION("Only changed lines are word-wrapped again")
+        {
+            // After editing, the lines must be the same as when the text was set at once
+            auto checkLines = [&]{
+                auto textBox2 = tgui::TextBox::copy(textBox);
+                textBox2->setText(textBox->getText());
+                REQUIRE(textBox->getLinesCount() == textBox2->getLinesCount());
+
+                const std::size_t caretPosition = textBox->getCaretPosition();
+                textBox2->setCaretPosition(caretPosition);
+                REQUIRE(textBox2->getCaretPosition() == caretPosition);
+            };
+
+            textBox->setText("A\n\nB");
+            checkLines();
+
+            // Inserting a newline next to an identical character
+            textBox->setCaretPosition(2);
+            textBox->textEntered('\n');
+            REQUIRE(textBox->getText() == "A\n\n\nB");
+            REQUIRE(textBox->getCaretPosition() == 3);
+            checkLines();
+
+            textBox->textEntered('C');
+            REQUIRE(textBox->getText() == "A\n\nC\nB");
+            checkLines();
+
+            for (char c : std::string("Some words that are long enough to be wrapped over several lines"))
+                textBox->textEntered(c);
+            REQUIRE(textBox->getLinesCount() > 6);
+            checkLines();
+
+            textBox->setCaretPosition(10);
+            for (unsigned int i = 0; i < 5; ++i)
+                textBox->textEntered('\n');
+            checkLines();
+
+            textBox->setSelectedText(4, 30);
+            textBox->textEntered('X');
+            checkLines();
+
+            textBox->setSize(300, 100);
+            checkLines();
+
+            textBox->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
+            textBox->setText(textBox->getText() + "\nEnd");
+            checkLines();
+
+            textBox->setCaretPosition(0);
+            textBox->textEntered('Y');
+            REQUIRE(textBox->getText()[0] == 'Y');
+            checkLines();
+        }
+
         // TODO: TextChanged and SelectionChanged events
     }
 
@@ -647,6 +702,44 @@ TEST_CASE("[TextBox]")
                 TEST_DRAW("TextBox_ForcedScrollbars.png")
             }
         }
+
+        SECTION("Scrolling from code")
+        {
+            std::string text;
+            for (unsigned int i = 0; i < 100; ++i)
+                text += "Line " + std::to_string(i) + "\n";
+
+            textBox->setFocused(false);
+            textBox->setHorizontalScrollbarPolicy(tgui::Scrollbar::Policy::Never);
+            textBox->setText(text);
+            auto textBox2 = tgui::TextBox::copy(textBox);
+
+            // Scrolling with the mouse wheel far past the lines that were initially visible
+            for (unsigned int i = 0; i < 30; ++i)
+                textBox->mouseWheelScrolled(-1, {100, 50});
+
+            const unsigned int value = textBox->getVerticalScrollbarValue();
+            REQUIRE(value > 0);
+
+            target.clear({25, 130, 10});
+            gui.draw();
+            target.display();
+            const sf::Image scrolledImage = target.getTexture().copyToImage();
+
+            // Setting the same scrollbar value from code has to show the same lines
+            gui.remove(textBox);
+            gui.add(textBox2);
+            textBox2->setVerticalScrollbarValue(value);
+            REQUIRE(textBox2->getVerticalScrollbarValue() == value);
+
+            target.clear({25, 130, 10});
+            gui.draw();
+            target.display();
+            const sf::Image image = target.getTexture().copyToImage();
+
+            const std::size_t pixelBytes = 270 * 160 * 4;
+            REQUIRE(std::equal(image.getPixelsPtr(), image.getPixelsPtr() + pixelBytes, scrolledImage.getPixelsPtr()));
+        }
     }
 
     SECTION("Bug Fixes")
@@ -26,6 +26,18 @@
 #include <TGUI/Widgets/TreeView.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 
+static void getExpectedVisibleItems(const std::vector<tgui::TreeView::ConstNode>& nodes, std::vector<sf::String> hierarchy, std::vector<std::vector<sf::String>>& items)
+{
+    for (const auto& node : nodes)
+    {
+        hierarchy.push_back(node.text);
+        items.push_back(hierarchy);
+        if (node.expanded)
+            getExpectedVisibleItems(node.nodes, hierarchy, items);
+        hierarchy.pop_back();
+    }
+}
+
 TEST_CASE("[TreeView]")
 {
     auto treeView = tgui::TreeView::create();
@@ -214,6 +226,127 @@ TEST_CASE("[TreeView]")
         REQUIRE(treeView->getSelectedItem().empty());
     }
 
+    SECTION("Visible items")
+    {
+        treeView->getRenderer()->setBorders(0);
+        treeView->getRenderer()->setPadding(0);
+        treeView->setItemHeight(20);
+        treeView->setSize(400, 4000);
+
+        // Find out which item is on each row by clicking on the rows
+        auto getVisibleItems = [=]{
+            std::vector<std::vector<sf::String>> items;
+            for (float y = 10; y < 4000; y += 20)
+            {
+                treeView->leftMousePressed({300, y});
+                if (treeView->getSelectedItem().empty())
+                    break;
+
+                items.push_back(treeView->getSelectedItem());
+            }
+            return items;
+        };
+
+        auto getExpectedItems = [=]{
+            std::vector<std::vector<sf::String>> items;
+            getExpectedVisibleItems(treeView->getNodes(), {}, items);
+            return items;
+        };
+
+        // Enough root items to search them with a hash map
+        for (unsigned int i = 0; i < 40; ++i)
+        {
+            treeView->addItem({"Item" + tgui::to_string(i)});
+            if (i % 3 == 0)
+                treeView->addItem({"Item" + tgui::to_string(i), "Sub", "Leaf"});
+        }
+        REQUIRE(getVisibleItems().size() == 68);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->collapse({"Item6"});
+        REQUIRE(getVisibleItems().size() == 66);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->collapse({"Item9", "Sub"});
+        treeView->addItem({"Item6", "Sub", "Other"});
+        treeView->addItem({"Item9", "Sub", "Other"});
+        treeView->addItem({"Item9", "Other"});
+        REQUIRE(getVisibleItems().size() == 66);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->expand({"Item9", "Sub", "Other"});
+        REQUIRE(getVisibleItems().size() == 68);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->expand({"Item6"});
+        REQUIRE(getVisibleItems().size() == 71);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        REQUIRE(treeView->removeItem({"Item6", "Sub", "Leaf"}));
+        REQUIRE(treeView->removeItem({"Item3", "Sub", "Leaf"}));
+        REQUIRE(treeView->removeItem({"Item12", "Sub"}, false));
+        REQUIRE(treeView->removeItem({"Item20"}));
+        REQUIRE(!treeView->removeItem({"Item20"}));
+        REQUIRE(getVisibleItems().size() == 64);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->addItem({"Item20"});
+        REQUIRE(getVisibleItems().back() == std::vector<sf::String>{"Item20"});
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        // The selected item keeps selected while rows are inserted or removed in front of it
+        REQUIRE(treeView->selectItem({"Item30", "Sub", "Leaf"}));
+        treeView->collapse({"Item0"});
+        treeView->addItem({"Item1", "New"});
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"Item30", "Sub", "Leaf"});
+
+        // The selected item is deselected when it gets hidden
+        treeView->collapse({"Item30"});
+        REQUIRE(treeView->getSelectedItem().empty());
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->collapseAll();
+        REQUIRE(getVisibleItems().size() == 39);
+        REQUIRE(getVisibleItems() == getExpectedItems());
+
+        treeView->expandAll();
+        REQUIRE(getVisibleItems() == getExpectedItems());
+    }
+
+    SECTION("Lazy items")
+    {
+        unsigned int loadCount = 0;
+        treeView->setLazyItemLoader([&](const std::vector<sf::String>& hierarchy){
+            loadCount++;
+            REQUIRE(hierarchy == std::vector<sf::String>{"Folder", "Lazy"});
+            treeView->addItem({"Folder", "Lazy", "File1"});
+            treeView->addItem({"Folder", "Lazy", "File2"});
+        });
+
+        REQUIRE(treeView->addLazyItem({"Folder", "Lazy"}));
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.empty());
+
+        // Lazy items aren't loaded by expandAll
+        treeView->expandAll();
+        REQUIRE(loadCount == 0);
+        REQUIRE(!treeView->getNodes()[0].nodes[0].expanded);
+
+        treeView->expand({"Folder", "Lazy"});
+        REQUIRE(loadCount == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 2);
+
+        treeView->collapse({"Folder", "Lazy"});
+        treeView->expand({"Folder", "Lazy"});
+        REQUIRE(loadCount == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].nodes.size() == 2);
+
+        REQUIRE(treeView->selectItem({"Folder", "Lazy", "File2"}));
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"Folder", "Lazy", "File2"});
+    }
+
     SECTION("ItemHeight")
     {
         treeView->setItemHeight(30);
@@ -109,6 +109,50 @@ TEST_CASE("[VerticalLayout]")
         }
     }
 
+    SECTION("Postponed updates")
+    {
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        button1->setSize({50, 20});
+
+        unsigned int sizeChangedCount = 0;
+        button1->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+        REQUIRE(!layout->isUpdating());
+        layout->beginUpdate();
+        REQUIRE(layout->isUpdating());
+
+        layout->add(button1);
+        layout->add(button2);
+        layout->beginUpdate();
+        layout->insert(0, button3);
+        layout->endUpdate();
+
+        // The widgets aren't repositioned until the last endUpdate call
+        REQUIRE(layout->isUpdating());
+        REQUIRE(button1->getSize() == sf::Vector2f(50, 20));
+        REQUIRE(sizeChangedCount == 0);
+
+        layout->endUpdate();
+        REQUIRE(!layout->isUpdating());
+        REQUIRE(sizeChangedCount == 1);
+        REQUIRE(layout->get(0) == button3);
+        REQUIRE(button3->getPosition() == sf::Vector2f(0, 0));
+        REQUIRE(button1->getPosition().y == Approx(800 / 3.f));
+        REQUIRE(button2->getPosition().y == Approx(1600 / 3.f));
+        REQUIRE(button1->getFullSize().x == 1000);
+        REQUIRE(button1->getFullSize().y == Approx(800 / 3.f));
+
+        // Adding in bulk positions the widgets once as well
+        layout->removeAllWidgets();
+        sizeChangedCount = 0;
+        layout->addBulk({button1, button2});
+        REQUIRE(sizeChangedCount == 1);
+        REQUIRE(button1->getFullSize() == sf::Vector2f(1000, 400));
+        REQUIRE(button2->getPosition() == sf::Vector2f(0, 400));
+    }
+
     SECTION("Order")
     {
         REQUIRE(layout->get(0) == nullptr);